@@ -1,7 +1,11 @@
+#include <cstdint>
+#include <utility>
+
 #include <Kokkos_Core.hpp>
 #include <benchmark/benchmark.h>
 
 #include <brak/wrapper_array.hpp>
+#include <brak/wrapper_offset.hpp>
 #include <brak/wrapper_subview.hpp>
 
 void benchmark_set_wrapper_subview(benchmark::State &state) {
@@ -28,6 +32,31 @@ void benchmark_set_wrapper_array(benchmark::State &state) {
 
 BENCHMARK(benchmark_set_wrapper_array);
 
+void benchmark_set_wrapper_array_index_32(benchmark::State &state) {
+  using View = Kokkos::View<int ********,
+                            Kokkos::DefaultHostExecutionSpace::memory_space>;
+  View data{"data", 2, 2, 2, 2, 2, 2, 2, 2};
+  brak::WrapperArray<View, 0, std::int32_t> dataWrapper{data};
+
+  while (state.KeepRunning()) {
+    dataWrapper[1][1][1][1][1][1][1][1] = 10;
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_index_32);
+
+void benchmark_set_wrapper_offset(benchmark::State &state) {
+  Kokkos::View<int ********, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 2, 2, 2, 2, 2, 2, 2, 2};
+  brak::WrapperOffset dataWrapper{data};
+
+  while (state.KeepRunning()) {
+    dataWrapper[1][1][1][1][1][1][1][1] = 10;
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_offset);
+
 void benchmark_set_view(benchmark::State &state) {
   Kokkos::View<int ********, Kokkos::DefaultHostExecutionSpace::memory_space>
       data{"data", 2, 2, 2, 2, 2, 2, 2, 2};
@@ -52,3 +81,28 @@ void benchmark_set_view_unmanaged(benchmark::State &state) {
 }
 
 BENCHMARK(benchmark_set_view_unmanaged);
+
+void benchmark_set_view_subview_range(benchmark::State &state) {
+  Kokkos::View<int ********, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 2, 2, 2, 2, 2, 2, 2, 2};
+
+  while (state.KeepRunning()) {
+    Kokkos::subview(data, std::make_pair(1, 2), Kokkos::ALL, Kokkos::ALL,
+                    Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
+                    Kokkos::ALL)(0, 1, 1, 1, 1, 1, 1, 1) = 10;
+  }
+}
+
+BENCHMARK(benchmark_set_view_subview_range);
+
+void benchmark_set_wrapper_array_range(benchmark::State &state) {
+  Kokkos::View<int ********, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 2, 2, 2, 2, 2, 2, 2, 2};
+  brak::WrapperArray dataWrapper{data};
+
+  while (state.KeepRunning()) {
+    dataWrapper[brak::range(1, 2)][0][1][1][1][1][1][1][1] = 10;
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_range);
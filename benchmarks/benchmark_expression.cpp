@@ -0,0 +1,124 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/expression.hpp>
+#include <brak/wrapper_array.hpp>
+
+// Whole-array statements on fields of rank 3, either written as a hand-made
+// loop nest over the brackets of array wrappers, or as an expression assigned
+// to an array wrapper, which is evaluated in a single kernel. The benchmarks
+// are instantiated for the serial and the OpenMP backends, when enabled.
+
+constexpr double coeff = 0.1;
+
+// Copy a field with a hand-made loop nest.
+template <typename ExecutionSpace>
+void benchmark_copy_loop(benchmark::State &state) {
+  using View = Kokkos::View<double ***, ExecutionSpace>;
+  std::int64_t const size = state.range(0);
+  View field{"field", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_copy_loop",
+        Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<3>>(
+            {0, 0, 0}, {size, size, size}),
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k) {
+          fieldWrapper[i][j][k] = fieldTempWrapper[i][j][k];
+        });
+    Kokkos::fence();
+  }
+}
+
+// Copy a field with an expression.
+template <typename ExecutionSpace>
+void benchmark_copy_expression(benchmark::State &state) {
+  using View = Kokkos::View<double ***, ExecutionSpace>;
+  std::int64_t const size = state.range(0);
+  View field{"field", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    brak::expr(fieldWrapper, "benchmark_copy_expression") = fieldTempWrapper;
+    Kokkos::fence();
+  }
+}
+
+// Combine two fields with a hand-made loop nest.
+template <typename ExecutionSpace>
+void benchmark_combination_loop(benchmark::State &state) {
+  using View = Kokkos::View<double ***, ExecutionSpace>;
+  std::int64_t const size = state.range(0);
+  View field{"field", size, size, size};
+  View fieldOther{"fieldOther", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldOtherWrapper{fieldOther};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_combination_loop",
+        Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<3>>(
+            {0, 0, 0}, {size, size, size}),
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k) {
+          fieldTempWrapper[i][j][k] =
+              fieldWrapper[i][j][k] + coeff * fieldOtherWrapper[i][j][k];
+        });
+    Kokkos::fence();
+  }
+}
+
+// Combine two fields with an expression.
+template <typename ExecutionSpace>
+void benchmark_combination_expression(benchmark::State &state) {
+  using View = Kokkos::View<double ***, ExecutionSpace>;
+  std::int64_t const size = state.range(0);
+  View field{"field", size, size, size};
+  View fieldOther{"fieldOther", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldOtherWrapper{fieldOther};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    brak::expr(fieldTempWrapper, "benchmark_combination_expression") =
+        fieldWrapper + coeff * fieldOtherWrapper;
+    Kokkos::fence();
+  }
+}
+
+#ifdef KOKKOS_ENABLE_SERIAL
+BENCHMARK_TEMPLATE(benchmark_copy_loop, Kokkos::Serial)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(benchmark_copy_expression, Kokkos::Serial)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(benchmark_combination_loop, Kokkos::Serial)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(benchmark_combination_expression, Kokkos::Serial)
+    ->Arg(64)
+    ->Arg(256);
+#endif // ifdef KOKKOS_ENABLE_SERIAL
+
+#ifdef KOKKOS_ENABLE_OPENMP
+BENCHMARK_TEMPLATE(benchmark_copy_loop, Kokkos::OpenMP)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(benchmark_copy_expression, Kokkos::OpenMP)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(benchmark_combination_loop, Kokkos::OpenMP)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(benchmark_combination_expression, Kokkos::OpenMP)
+    ->Arg(64)
+    ->Arg(256);
+#endif // ifdef KOKKOS_ENABLE_OPENMP
@@ -0,0 +1,165 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/mapped_array.hpp>
+#include <brak/wrapper_array.hpp>
+
+// Raw binary file of a C array of rank 2 of doubles, with rows of 1024
+// elements, either read in a view then wrapped, or mapped. The file is
+// created for each benchmark and removed at its end, and is likely in the
+// page cache of the system when measuring: for cold reads, the cache must be
+// dropped before the measurement.
+
+using View = Kokkos::View<double **, Kokkos::HostSpace>;
+using MappedArray = brak::MappedArray<double const, 2>;
+
+constexpr std::int64_t columns = 1024;
+constexpr std::int64_t mebi = 1024 * 1024;
+
+// File of a given size in MiB in the temporary directory, removed when
+// destroyed.
+class BenchmarkFile {
+  std::string mPath;
+  std::int64_t mRows;
+  bool mIsWritten = false;
+
+public:
+  explicit BenchmarkFile(std::int64_t const sizeMebi)
+      : mPath((std::filesystem::temp_directory_path() /
+               ("benchmark_mapped_array_" + std::to_string(sizeMebi) +
+                ".bin"))
+                  .string()),
+        mRows(sizeMebi * mebi / (columns * sizeof(double))) {
+    std::vector<double> row(columns, 1);
+    std::ofstream file{mPath, std::ios::binary};
+    for (std::int64_t i = 0; i < mRows && file; i++) {
+      file.write(reinterpret_cast<char const *>(row.data()),
+                 columns * sizeof(double));
+    }
+    file.close();
+    mIsWritten = static_cast<bool>(file);
+  }
+
+  ~BenchmarkFile() {
+    std::error_code error;
+    std::filesystem::remove(mPath, error);
+  }
+
+  BenchmarkFile(BenchmarkFile const &) = delete;
+  BenchmarkFile &operator=(BenchmarkFile const &) = delete;
+
+  std::string const &getPath() const { return mPath; }
+
+  std::int64_t getRows() const { return mRows; }
+
+  bool isWritten() const { return mIsWritten; }
+};
+
+void benchmark_mapped_array_read_then_wrap_startup(benchmark::State &state) {
+  BenchmarkFile const benchmarkFile{state.range(0)};
+  if (!benchmarkFile.isWritten()) {
+    state.SkipWithError("Cannot write the file to map");
+    return;
+  }
+  std::string const &path = benchmarkFile.getPath();
+  std::int64_t const rows = benchmarkFile.getRows();
+
+  while (state.KeepRunning()) {
+    View data{Kokkos::view_alloc(Kokkos::WithoutInitializing, "data"), rows,
+              columns};
+    std::ifstream file{path, std::ios::binary};
+    file.read(reinterpret_cast<char *>(data.data()),
+              rows * columns * sizeof(double));
+    brak::WrapperArray dataWrapper{data};
+
+    benchmark::DoNotOptimize(dataWrapper[rows / 2][columns / 2]);
+  }
+}
+
+BENCHMARK(benchmark_mapped_array_read_then_wrap_startup)->Arg(64)->Arg(1024);
+
+void benchmark_mapped_array_mapped_startup(benchmark::State &state) {
+  BenchmarkFile const benchmarkFile{state.range(0)};
+  if (!benchmarkFile.isWritten()) {
+    state.SkipWithError("Cannot write the file to map");
+    return;
+  }
+  std::string const &path = benchmarkFile.getPath();
+  std::int64_t const rows = benchmarkFile.getRows();
+
+  while (state.KeepRunning()) {
+    MappedArray const data{path, rows, columns};
+    data.advise(brak::MappedAccess::random);
+
+    benchmark::DoNotOptimize(data[rows / 2][columns / 2]);
+  }
+}
+
+BENCHMARK(benchmark_mapped_array_mapped_startup)->Arg(64)->Arg(1024);
+
+void benchmark_mapped_array_read_then_wrap_sum(benchmark::State &state) {
+  BenchmarkFile const benchmarkFile{state.range(0)};
+  if (!benchmarkFile.isWritten()) {
+    state.SkipWithError("Cannot write the file to map");
+    return;
+  }
+  std::string const &path = benchmarkFile.getPath();
+  std::int64_t const rows = benchmarkFile.getRows();
+
+  while (state.KeepRunning()) {
+    View data{Kokkos::view_alloc(Kokkos::WithoutInitializing, "data"), rows,
+              columns};
+    std::ifstream file{path, std::ios::binary};
+    file.read(reinterpret_cast<char *>(data.data()),
+              rows * columns * sizeof(double));
+    brak::WrapperArray dataWrapper{data};
+
+    double sum = 0;
+    for (std::int64_t i = 0; i < rows; i++) {
+      for (std::int64_t j = 0; j < columns; j++) {
+        sum += dataWrapper[i][j];
+      }
+    }
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0) * mebi);
+}
+
+BENCHMARK(benchmark_mapped_array_read_then_wrap_sum)->Arg(64)->Arg(1024);
+
+void benchmark_mapped_array_mapped_sum(benchmark::State &state) {
+  BenchmarkFile const benchmarkFile{state.range(0)};
+  if (!benchmarkFile.isWritten()) {
+    state.SkipWithError("Cannot write the file to map");
+    return;
+  }
+  std::string const &path = benchmarkFile.getPath();
+  std::int64_t const rows = benchmarkFile.getRows();
+
+  while (state.KeepRunning()) {
+    MappedArray const data{path, rows, columns};
+    data.advise(brak::MappedAccess::sequential);
+
+    double sum = 0;
+    for (std::int64_t i = 0; i < rows; i++) {
+      for (std::int64_t j = 0; j < columns; j++) {
+        sum += data[i][j];
+      }
+    }
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0) * mebi);
+}
+
+BENCHMARK(benchmark_mapped_array_mapped_sum)->Arg(64)->Arg(1024);
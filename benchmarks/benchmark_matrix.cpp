@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/kokkos_view.hpp>
+#include <brak/wrapper_array.hpp>
+#include <brak/wrapper_offset.hpp>
+#include <brak/wrapper_subview.hpp>
+
+// Matrix of benchmarks sweeping the implementation, the value type, the
+// layout, the rank and the size of the data. Each benchmark increments all
+// the elements of a view with nested `for` loops, the right-most index being
+// the innermost one.
+
+// Sizes of the data in bytes, from L1-resident to DRAM-bound.
+constexpr std::size_t sizes[] = {std::size_t(16) << 10, std::size_t(512) << 10,
+                                 std::size_t(16) << 20, std::size_t(256) << 20};
+
+// Managed view.
+struct ImplementationView {
+  static constexpr char const *name = "view";
+
+  template <typename View> static auto make(View const data) { return data; }
+};
+
+// Unmanaged view.
+struct ImplementationViewUnmanaged {
+  static constexpr char const *name = "view_unmanaged";
+
+  template <typename View> static auto make(View const data) {
+    return kokkos_addendum::make_unmanaged<View>(data);
+  }
+};
+
+// Subview wrapper.
+struct ImplementationWrapperSubview {
+  static constexpr char const *name = "wrapper_subview";
+
+  template <typename View> static auto make(View const data) {
+    return brak::WrapperSubview<View>(data);
+  }
+};
+
+// Array wrapper.
+struct ImplementationWrapperArray {
+  static constexpr char const *name = "wrapper_array";
+
+  template <typename View> static auto make(View const data) {
+    return brak::WrapperArray<View>(data);
+  }
+};
+
+// Offset wrapper.
+struct ImplementationWrapperOffset {
+  static constexpr char const *name = "wrapper_offset";
+
+  template <typename View> static auto make(View const data) {
+    return brak::WrapperOffset<View>(data);
+  }
+};
+
+template <typename ValueType> constexpr char const *value_type_name = "";
+template <> constexpr char const *value_type_name<int> = "int";
+template <> constexpr char const *value_type_name<float> = "float";
+template <> constexpr char const *value_type_name<double> = "double";
+template <>
+constexpr char const *value_type_name<Kokkos::complex<double>> = "complex";
+
+template <typename Layout> constexpr char const *layout_name = "";
+template <> constexpr char const *layout_name<Kokkos::LayoutRight> = "right";
+template <> constexpr char const *layout_name<Kokkos::LayoutLeft> = "left";
+template <> constexpr char const *layout_name<Kokkos::LayoutStride> = "stride";
+
+// Access to an element of a view with the parentheses operator.
+template <typename Data, typename... IndicesType,
+          std::enable_if_t<Kokkos::is_view<Data>::value, int> = 0>
+decltype(auto) access(Data const &data, IndicesType const... indices) {
+  return data(indices...);
+}
+
+// Access to an element of a wrapper with a chain of brackets operators.
+template <typename Data, typename IndexType, typename... IndicesType,
+          std::enable_if_t<!Kokkos::is_view<Data>::value, int> = 0>
+decltype(auto) access(Data const &data, IndexType const index,
+                      IndicesType const... indices) {
+  if constexpr (sizeof...(indices) == 0) {
+    return data[index];
+  } else {
+    return access(data[index], indices...);
+  }
+}
+
+// Increment all the elements with nested `for` loops.
+template <std::size_t rank, typename Data, typename... IndicesType>
+void increment(Data const &data, std::size_t const extent,
+               IndicesType const... indices) {
+  if constexpr (sizeof...(indices) == rank) {
+    using ValueType = std::remove_reference_t<decltype(access(
+        data, indices...))>;
+    access(data, indices...) += ValueType(1);
+  } else {
+    for (std::size_t index = 0; index < extent; index++) {
+      increment<rank>(data, extent, indices..., index);
+    }
+  }
+}
+
+// Create a view with the same extent in each dimension.
+template <typename View, std::size_t... indexSequence>
+View create_view(std::size_t const extent,
+                 [[maybe_unused]] std::index_sequence<indexSequence...>
+                     indexSequenceArg) {
+  if constexpr (std::is_same_v<typename View::array_layout,
+                               Kokkos::LayoutStride>) {
+    // strides of a right layout, not known at compile time
+    Kokkos::LayoutStride layout;
+    std::size_t stride = 1;
+    for (int dimension = View::rank() - 1; dimension >= 0; dimension--) {
+      layout.dimension[dimension] = extent;
+      layout.stride[dimension] = stride;
+      stride *= extent;
+    }
+
+    return View("data", layout);
+  } else {
+    return View("data", (static_cast<void>(indexSequence), extent)...);
+  }
+}
+
+template <typename Implementation, typename ValueType, typename Layout,
+          std::size_t rank>
+void benchmark_matrix(benchmark::State &state, std::size_t const bytes) {
+  using View =
+      Kokkos::View<typename kokkos_addendum::add_pointers<ValueType,
+                                                          rank>::type,
+                   Layout, Kokkos::HostSpace>;
+
+  // the extent is the same in each dimension, and at least 2
+  std::size_t const extent = std::max(
+      std::size_t(2),
+      static_cast<std::size_t>(std::round(std::pow(
+          static_cast<double>(bytes) / sizeof(ValueType), 1. / rank))));
+  std::size_t elements = 1;
+  for (std::size_t dimension = 0; dimension < rank; dimension++) {
+    elements *= extent;
+  }
+
+  View data = create_view<View>(extent, std::make_index_sequence<rank>());
+  auto const dataImplementation = Implementation::make(data);
+
+  for (auto _ : state) {
+    increment<rank>(dataImplementation, extent);
+    benchmark::ClobberMemory();
+  }
+
+  // each element is read and written once per iteration
+  state.SetItemsProcessed(state.iterations() * elements);
+  state.SetBytesProcessed(state.iterations() * elements * sizeof(ValueType) *
+                          2);
+  state.counters["extent"] = extent;
+  state.counters["bytes"] = elements * sizeof(ValueType);
+}
+
+template <typename Implementation, typename ValueType, typename Layout,
+          std::size_t... ranks>
+void register_ranks([[maybe_unused]] std::index_sequence<ranks...>
+                        indexSequenceArg) {
+  for (std::size_t const bytes : sizes) {
+    (benchmark::RegisterBenchmark(
+         (std::string("benchmark_matrix/") + Implementation::name + "/" +
+          value_type_name<ValueType> + "/" + layout_name<Layout> +
+          "/rank:" + std::to_string(ranks + 1) +
+          "/bytes:" + std::to_string(bytes))
+             .c_str(),
+         benchmark_matrix<Implementation, ValueType, Layout, ranks + 1>,
+         bytes),
+     ...);
+  }
+}
+
+template <typename Implementation, typename ValueType>
+void register_layouts() {
+  register_ranks<Implementation, ValueType, Kokkos::LayoutRight>(
+      std::make_index_sequence<8>());
+  register_ranks<Implementation, ValueType, Kokkos::LayoutLeft>(
+      std::make_index_sequence<8>());
+  register_ranks<Implementation, ValueType, Kokkos::LayoutStride>(
+      std::make_index_sequence<8>());
+}
+
+template <typename Implementation> void register_value_types() {
+  register_layouts<Implementation, int>();
+  register_layouts<Implementation, float>();
+  register_layouts<Implementation, double>();
+  register_layouts<Implementation, Kokkos::complex<double>>();
+}
+
+// Register all the benchmarks of the matrix.
+[[maybe_unused]] bool const registered = []() {
+  register_value_types<ImplementationView>();
+  register_value_types<ImplementationViewUnmanaged>();
+  register_value_types<ImplementationWrapperSubview>();
+  register_value_types<ImplementationWrapperArray>();
+  register_value_types<ImplementationWrapperOffset>();
+
+  return true;
+}();
@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/mirror.hpp>
+#include <brak/wrapper_subview.hpp>
+
+// Pipeline of a computation on chunks of a view of rank 3, each chunk being
+// copied into a mirror once computed. On a single instance, copies and
+// computations are serialized; on two instances obtained by partitioning the
+// host execution space, the copy of a chunk overlaps the computation of the
+// next one. The benchmarks are meant to be run with the OpenMP backend.
+
+using ExecutionSpace = Kokkos::DefaultHostExecutionSpace;
+using View = Kokkos::View<double ***, ExecutionSpace>;
+using Policy = Kokkos::RangePolicy<ExecutionSpace>;
+
+constexpr std::int64_t chunks = 8;
+constexpr std::int64_t iterations = 16;
+
+// Compute a chunk on an instance.
+template <typename Wrapper>
+void compute_chunk(ExecutionSpace const &exec, Wrapper const &chunk) {
+  std::int64_t const rows = chunk.getExtent(0);
+  std::int64_t const size = chunk.getExtent(1);
+
+  Kokkos::parallel_for(
+      "compute_chunk", Policy(exec, 0, rows),
+      KOKKOS_LAMBDA(std::int64_t const i) {
+        for (std::int64_t j = 0; j < size; j++) {
+          double value = chunk[i][j];
+          for (std::int64_t iteration = 0; iteration < iterations;
+               iteration++) {
+            value = value * 0.5 + 1;
+          }
+          chunk[i][j] = value;
+        }
+      });
+}
+
+void benchmark_mirror_single_instance(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  View data{"data", chunks, size, size};
+  brak::WrapperSubview dataWrapper{data};
+  auto const dataMirror = brak::create_mirror(dataWrapper);
+  ExecutionSpace exec;
+
+  while (state.KeepRunning()) {
+    for (std::int64_t chunk = 0; chunk < chunks; chunk++) {
+      compute_chunk(exec, dataWrapper[chunk]);
+      brak::deep_copy_async(exec, dataMirror[chunk], dataWrapper[chunk]);
+      exec.fence();
+    }
+  }
+}
+
+BENCHMARK(benchmark_mirror_single_instance)->Arg(256)->Arg(1024);
+
+void benchmark_mirror_partitioned_instances(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  View data{"data", chunks, size, size};
+  brak::WrapperSubview dataWrapper{data};
+  auto const dataMirror = brak::create_mirror(dataWrapper);
+  std::vector<ExecutionSpace> const instances =
+      Kokkos::Experimental::partition_space(ExecutionSpace(), 1, 1);
+  ExecutionSpace const &execCompute = instances[0];
+  ExecutionSpace const &execCopy = instances[1];
+
+  while (state.KeepRunning()) {
+    for (std::int64_t chunk = 0; chunk < chunks; chunk++) {
+      compute_chunk(execCompute, dataWrapper[chunk]);
+      execCompute.fence();
+      // the copy of this chunk overlaps the computation of the next one
+      brak::deep_copy_async(execCopy, dataMirror[chunk], dataWrapper[chunk]);
+    }
+    execCopy.fence();
+  }
+}
+
+BENCHMARK(benchmark_mirror_partitioned_instances)->Arg(256)->Arg(1024);
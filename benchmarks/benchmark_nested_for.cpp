@@ -1,7 +1,11 @@
 #include <Kokkos_Core.hpp>
 #include <benchmark/benchmark.h>
 
+#include <brak/aliasing.hpp>
+#include <brak/simd.hpp>
+#include <brak/stencil.hpp>
 #include <brak/wrapper_array.hpp>
+#include <brak/wrapper_offset.hpp>
 #include <brak/wrapper_subview.hpp>
 
 const double coeff = 0.1;
@@ -70,6 +74,211 @@ void benchmark_set_wrapper_array(benchmark::State &state) {
 
 BENCHMARK(benchmark_set_wrapper_array);
 
+void benchmark_set_wrapper_array_static_extents(benchmark::State &state) {
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 30, 30, 30};
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", 30, 30, 30};
+  auto dataWrapper = brak::make_wrapper<30, 30>(data);
+  auto dataTempWrapper = brak::make_wrapper<30, 30>(dataTemp);
+
+  dataWrapper[14][14][14] = 1;
+
+  while (state.KeepRunning()) {
+    for (unsigned i = 1; i < data.extent(0) - 1; i++)
+      for (unsigned j = 1; j < data.extent(1) - 1; j++)
+        for (unsigned k = 1; k < data.extent(2) - 1; k++) {
+          dataTempWrapper[i][j][k] =
+              dataWrapper[i][j][k] +
+              coeff * (-6 * dataWrapper[i][j][k] + dataWrapper[i - 1][j][k] +
+                       dataWrapper[i + 1][j][k] + dataWrapper[i][j - 1][k] +
+                       dataWrapper[i][j + 1][k] + dataWrapper[i][j][k - 1] +
+                       dataWrapper[i][j][k + 1]);
+        }
+
+    for (unsigned i = 0; i < data.extent(0); i++)
+      for (unsigned j = 0; j < data.extent(1); j++)
+        for (unsigned k = 0; k < data.extent(2); k++) {
+          dataWrapper[i][j][k] = dataTempWrapper[i][j][k];
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_static_extents);
+
+void benchmark_set_wrapper_array_stencil(benchmark::State &state) {
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 30, 30, 30};
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", 30, 30, 30};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+
+  dataWrapper[14][14][14] = 1;
+
+  while (state.KeepRunning()) {
+    for (unsigned i = 1; i < data.extent(0) - 1; i++)
+      for (unsigned j = 1; j < data.extent(1) - 1; j++)
+        for (unsigned k = 1; k < data.extent(2) - 1; k++) {
+          brak::Stencil const stencil{dataWrapper, i, j, k};
+          dataTempWrapper[i][j][k] =
+              stencil() +
+              coeff * (-6 * stencil() + stencil.at<-1, 0, 0>() +
+                       stencil.at<1, 0, 0>() + stencil.at<0, -1, 0>() +
+                       stencil.at<0, 1, 0>() + stencil.at<0, 0, -1>() +
+                       stencil.at<0, 0, 1>());
+        }
+
+    for (unsigned i = 0; i < data.extent(0); i++)
+      for (unsigned j = 0; j < data.extent(1); j++)
+        for (unsigned k = 0; k < data.extent(2); k++) {
+          dataWrapper[i][j][k] = dataTempWrapper[i][j][k];
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_stencil);
+
+// Same loop nest, with the wrapper read from marked as read-only and the
+// wrapper written to marked as restrict, so that the compiler knows that they
+// do not alias and can vectorize the inner loop without runtime checks.
+void benchmark_set_wrapper_array_readonly_restrict(benchmark::State &state) {
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 30, 30, 30};
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", 30, 30, 30};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+
+  dataWrapper[14][14][14] = 1;
+
+  while (state.KeepRunning()) {
+    {
+      auto const dataReadonly = brak::readonly(dataWrapper);
+      auto const dataTempRestrict = brak::restrict(dataTempWrapper);
+
+      for (unsigned i = 1; i < data.extent(0) - 1; i++)
+        for (unsigned j = 1; j < data.extent(1) - 1; j++)
+          for (unsigned k = 1; k < data.extent(2) - 1; k++) {
+            dataTempRestrict[i][j][k] =
+                dataReadonly[i][j][k] +
+                coeff *
+                    (-6 * dataReadonly[i][j][k] + dataReadonly[i - 1][j][k] +
+                     dataReadonly[i + 1][j][k] + dataReadonly[i][j - 1][k] +
+                     dataReadonly[i][j + 1][k] + dataReadonly[i][j][k - 1] +
+                     dataReadonly[i][j][k + 1]);
+          }
+    }
+
+    for (unsigned i = 0; i < data.extent(0); i++)
+      for (unsigned j = 0; j < data.extent(1); j++)
+        for (unsigned k = 0; k < data.extent(2); k++) {
+          dataWrapper[i][j][k] = dataTempWrapper[i][j][k];
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_readonly_restrict);
+
+void benchmark_set_wrapper_array_simd(benchmark::State &state) {
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 30, 30, 30};
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", 30, 30, 30};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+  using Simd = brak::native_simd<double>;
+  std::size_t const width = Simd::size();
+
+  dataWrapper[14][14][14] = 1;
+
+  while (state.KeepRunning()) {
+    for (unsigned i = 1; i < data.extent(0) - 1; i++)
+      for (unsigned j = 1; j < data.extent(1) - 1; j++) {
+        std::size_t const kEnd = data.extent(2) - 1;
+        std::size_t k = 1;
+
+        for (; k + width <= kEnd; k += width) {
+          Simd const center = brak::simd_load(dataWrapper[i][j], k);
+          brak::simd_store(
+              dataTempWrapper[i][j], k,
+              center +
+                  coeff * (-6 * center +
+                           brak::simd_load(dataWrapper[i - 1][j], k) +
+                           brak::simd_load(dataWrapper[i + 1][j], k) +
+                           brak::simd_load(dataWrapper[i][j - 1], k) +
+                           brak::simd_load(dataWrapper[i][j + 1], k) +
+                           brak::simd_load(dataWrapper[i][j], k - 1) +
+                           brak::simd_load(dataWrapper[i][j], k + 1)));
+        }
+
+        if (k < kEnd) {
+          std::size_t const count = kEnd - k;
+          Simd const center =
+              brak::simd_load_masked(dataWrapper[i][j], k, count);
+          brak::simd_store_masked(
+              dataTempWrapper[i][j], k,
+              center +
+                  coeff *
+                      (-6 * center +
+                       brak::simd_load_masked(dataWrapper[i - 1][j], k,
+                                              count) +
+                       brak::simd_load_masked(dataWrapper[i + 1][j], k,
+                                              count) +
+                       brak::simd_load_masked(dataWrapper[i][j - 1], k,
+                                              count) +
+                       brak::simd_load_masked(dataWrapper[i][j + 1], k,
+                                              count) +
+                       brak::simd_load_masked(dataWrapper[i][j], k - 1,
+                                              count) +
+                       brak::simd_load_masked(dataWrapper[i][j], k + 1,
+                                              count)),
+              count);
+        }
+      }
+
+    for (unsigned i = 0; i < data.extent(0); i++)
+      for (unsigned j = 0; j < data.extent(1); j++)
+        for (unsigned k = 0; k < data.extent(2); k++) {
+          dataWrapper[i][j][k] = dataTempWrapper[i][j][k];
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_simd);
+
+void benchmark_set_wrapper_offset(benchmark::State &state) {
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 30, 30, 30};
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", 30, 30, 30};
+  brak::WrapperOffset dataWrapper{data};
+  brak::WrapperOffset dataTempWrapper{dataTemp};
+
+  dataWrapper[14][14][14] = 1;
+
+  while (state.KeepRunning()) {
+    for (unsigned i = 1; i < data.extent(0) - 1; i++)
+      for (unsigned j = 1; j < data.extent(1) - 1; j++)
+        for (unsigned k = 1; k < data.extent(2) - 1; k++) {
+          dataTempWrapper[i][j][k] =
+              dataWrapper[i][j][k] +
+              coeff * (-6 * dataWrapper[i][j][k] + dataWrapper[i - 1][j][k] +
+                       dataWrapper[i + 1][j][k] + dataWrapper[i][j - 1][k] +
+                       dataWrapper[i][j + 1][k] + dataWrapper[i][j][k - 1] +
+                       dataWrapper[i][j][k + 1]);
+        }
+
+    for (unsigned i = 0; i < data.extent(0); i++)
+      for (unsigned j = 0; j < data.extent(1); j++)
+        for (unsigned k = 0; k < data.extent(2); k++) {
+          dataWrapper[i][j][k] = dataTempWrapper[i][j][k];
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_offset);
+
 void benchmark_set_view(benchmark::State &state) {
   Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
       data{"data", 30, 30, 30};
@@ -135,3 +344,111 @@ void benchmark_set_view_unmanaged(benchmark::State &state) {
 }
 
 BENCHMARK(benchmark_set_view_unmanaged);
+
+// The following benchmarks use a left layout, where the right-most index of
+// the loop nest is strided.
+
+void benchmark_set_layout_left_view(benchmark::State &state) {
+  std::size_t const extent = state.range(0);
+  Kokkos::View<double ***, Kokkos::LayoutLeft,
+               Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", extent, extent, extent};
+  Kokkos::View<double ***, Kokkos::LayoutLeft,
+               Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", extent, extent, extent};
+
+  data(extent / 2, extent / 2, extent / 2) = 1;
+
+  while (state.KeepRunning()) {
+    for (unsigned i = 1; i < data.extent(0) - 1; i++)
+      for (unsigned j = 1; j < data.extent(1) - 1; j++)
+        for (unsigned k = 1; k < data.extent(2) - 1; k++) {
+          dataTemp(i, j, k) =
+              data(i, j, k) + coeff * (-6 * data(i, j, k) + data(i - 1, j, k) +
+                                       data(i + 1, j, k) + data(i, j - 1, k) +
+                                       data(i, j + 1, k) + data(i, j, k - 1) +
+                                       data(i, j, k + 1));
+        }
+
+    for (unsigned i = 0; i < data.extent(0); i++)
+      for (unsigned j = 0; j < data.extent(1); j++)
+        for (unsigned k = 0; k < data.extent(2); k++) {
+          data(i, j, k) = dataTemp(i, j, k);
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_layout_left_view)->Arg(30)->Arg(100);
+
+void benchmark_set_layout_left_wrapper_array(benchmark::State &state) {
+  std::size_t const extent = state.range(0);
+  Kokkos::View<double ***, Kokkos::LayoutLeft,
+               Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", extent, extent, extent};
+  Kokkos::View<double ***, Kokkos::LayoutLeft,
+               Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", extent, extent, extent};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+
+  dataWrapper[extent / 2][extent / 2][extent / 2] = 1;
+
+  while (state.KeepRunning()) {
+    for (unsigned i = 1; i < dataWrapper.getExtent(0) - 1; i++)
+      for (unsigned j = 1; j < dataWrapper.getExtent(1) - 1; j++)
+        for (unsigned k = 1; k < dataWrapper.getExtent(2) - 1; k++) {
+          dataTempWrapper[i][j][k] =
+              dataWrapper[i][j][k] +
+              coeff * (-6 * dataWrapper[i][j][k] + dataWrapper[i - 1][j][k] +
+                       dataWrapper[i + 1][j][k] + dataWrapper[i][j - 1][k] +
+                       dataWrapper[i][j + 1][k] + dataWrapper[i][j][k - 1] +
+                       dataWrapper[i][j][k + 1]);
+        }
+
+    for (unsigned i = 0; i < dataWrapper.getExtent(0); i++)
+      for (unsigned j = 0; j < dataWrapper.getExtent(1); j++)
+        for (unsigned k = 0; k < dataWrapper.getExtent(2); k++) {
+          dataWrapper[i][j][k] = dataTempWrapper[i][j][k];
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_layout_left_wrapper_array)->Arg(30)->Arg(100);
+
+// Same loop nest, with the brackets mapped onto the dimensions of the view in
+// reverse order, so that the right-most index is contiguous.
+void benchmark_set_layout_left_wrapper_array_reversed(
+    benchmark::State &state) {
+  std::size_t const extent = state.range(0);
+  Kokkos::View<double ***, Kokkos::LayoutLeft,
+               Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", extent, extent, extent};
+  Kokkos::View<double ***, Kokkos::LayoutLeft,
+               Kokkos::DefaultHostExecutionSpace::memory_space>
+      dataTemp{"data temp", extent, extent, extent};
+  auto dataWrapper = brak::make_wrapper_reversed(data);
+  auto dataTempWrapper = brak::make_wrapper_reversed(dataTemp);
+
+  dataWrapper[extent / 2][extent / 2][extent / 2] = 1;
+
+  while (state.KeepRunning()) {
+    for (unsigned i = 1; i < dataWrapper.getExtent(0) - 1; i++)
+      for (unsigned j = 1; j < dataWrapper.getExtent(1) - 1; j++)
+        for (unsigned k = 1; k < dataWrapper.getExtent(2) - 1; k++) {
+          dataTempWrapper[i][j][k] =
+              dataWrapper[i][j][k] +
+              coeff * (-6 * dataWrapper[i][j][k] + dataWrapper[i - 1][j][k] +
+                       dataWrapper[i + 1][j][k] + dataWrapper[i][j - 1][k] +
+                       dataWrapper[i][j + 1][k] + dataWrapper[i][j][k - 1] +
+                       dataWrapper[i][j][k + 1]);
+        }
+
+    for (unsigned i = 0; i < dataWrapper.getExtent(0); i++)
+      for (unsigned j = 0; j < dataWrapper.getExtent(1); j++)
+        for (unsigned k = 0; k < dataWrapper.getExtent(2); k++) {
+          dataWrapper[i][j][k] = dataTempWrapper[i][j][k];
+        }
+  }
+}
+
+BENCHMARK(benchmark_set_layout_left_wrapper_array_reversed)->Arg(30)->Arg(100);
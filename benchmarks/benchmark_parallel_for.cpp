@@ -1,7 +1,11 @@
+#include <cstdint>
+
 #include <Kokkos_Core.hpp>
 #include <benchmark/benchmark.h>
 
+#include <brak/parallel.hpp>
 #include <brak/wrapper_array.hpp>
+#include <brak/wrapper_offset.hpp>
 #include <brak/wrapper_subview.hpp>
 
 void benchmark_set_wrapper_subview(benchmark::State &state) {
@@ -40,6 +44,60 @@ void benchmark_set_wrapper_array(benchmark::State &state) {
 
 BENCHMARK(benchmark_set_wrapper_array);
 
+void benchmark_set_wrapper_array_index_32(benchmark::State &state) {
+  using View = Kokkos::View<int ******>;
+  View data{"data", 30, 30, 30, 30, 30, 30};
+  brak::WrapperArray<View, 0, std::int32_t> dataWrapper{data};
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_set_wrapper_array_index_32",
+        Kokkos::MDRangePolicy({0, 0, 0, 0, 0, 0}, {30, 30, 30, 30, 30, 30}),
+        KOKKOS_LAMBDA(int const i, int const j, int const k, int const l,
+                      int const m, int const n) {
+          dataWrapper[i][j][k][l][m][n] = i + j + k + l + m + n;
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_index_32);
+
+void benchmark_set_wrapper_array_parallel_nest(benchmark::State &state) {
+  Kokkos::View<int ******> data{"data", 30, 30, 30, 30, 30, 30};
+  brak::WrapperArray dataWrapper{data};
+
+  while (state.KeepRunning()) {
+    brak::parallel_nest(
+        "benchmark_set_wrapper_array_parallel_nest", dataWrapper,
+        KOKKOS_LAMBDA(int const i, int const j, int const k, int const l,
+                      int const m, int const n) {
+          dataWrapper[i][j][k][l][m][n] = i + j + k + l + m + n;
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_array_parallel_nest);
+
+void benchmark_set_wrapper_offset(benchmark::State &state) {
+  Kokkos::View<int ******> data{"data", 30, 30, 30, 30, 30, 30};
+  brak::WrapperOffset dataWrapper{data};
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_set_wrapper_offset",
+        Kokkos::MDRangePolicy({0, 0, 0, 0, 0, 0}, {30, 30, 30, 30, 30, 30}),
+        KOKKOS_LAMBDA(int const i, int const j, int const k, int const l,
+                      int const m, int const n) {
+          dataWrapper[i][j][k][l][m][n] = i + j + k + l + m + n;
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_set_wrapper_offset);
+
 void benchmark_set_view(benchmark::State &state) {
   Kokkos::View<int ******> data{"data", 30, 30, 30, 30, 30, 30};
 
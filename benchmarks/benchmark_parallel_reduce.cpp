@@ -0,0 +1,85 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/parallel.hpp>
+#include <brak/wrapper_array.hpp>
+
+void benchmark_residual_wrapper_array(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  Kokkos::View<double ***> field{"field", size, size, size};
+  Kokkos::View<double ***> fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    double residual = 0;
+    brak::transform_reduce(
+        fieldTempWrapper, fieldWrapper, {1, 1, 1},
+        {size - 1, size - 1, size - 1},
+        KOKKOS_LAMBDA(double const valueTemp, double const value) {
+          return Kokkos::abs(valueTemp - value);
+        },
+        Kokkos::Max<double>(residual));
+    benchmark::DoNotOptimize(residual);
+  }
+}
+
+BENCHMARK(benchmark_residual_wrapper_array)->Arg(50)->Arg(512);
+
+void benchmark_residual_view(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  Kokkos::View<double ***> field{"field", size, size, size};
+  Kokkos::View<double ***> fieldTemp{"fieldTemp", size, size, size};
+
+  while (state.KeepRunning()) {
+    double residual = 0;
+    Kokkos::parallel_reduce(
+        "benchmark_residual_view",
+        Kokkos::MDRangePolicy<Kokkos::Rank<3>>(
+            {1, 1, 1}, {size - 1, size - 1, size - 1}),
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k, double &value) {
+          value = Kokkos::max(value, Kokkos::abs(fieldTemp(i, j, k) -
+                                                 field(i, j, k)));
+        },
+        Kokkos::Max<double>(residual));
+    benchmark::DoNotOptimize(residual);
+  }
+}
+
+BENCHMARK(benchmark_residual_view)->Arg(50)->Arg(512);
+
+void benchmark_sum_wrapper_array(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  Kokkos::View<double ***> data{"data", size, size, size};
+  brak::WrapperArray dataWrapper{data};
+
+  while (state.KeepRunning()) {
+    double const sum = brak::reduce_sum(dataWrapper);
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(benchmark_sum_wrapper_array)->Arg(50)->Arg(512);
+
+void benchmark_sum_view(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  Kokkos::View<double ***> data{"data", size, size, size};
+
+  while (state.KeepRunning()) {
+    double sum = 0;
+    Kokkos::parallel_reduce(
+        "benchmark_sum_view",
+        Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {size, size, size}),
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k, double &value) {
+          value += data(i, j, k);
+        },
+        Kokkos::Sum<double>(sum));
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(benchmark_sum_view)->Arg(50)->Arg(512);
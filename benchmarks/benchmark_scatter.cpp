@@ -0,0 +1,122 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/scatter.hpp>
+#include <brak/wrapper_array.hpp>
+
+// Scatter-add of contributions into the bins of a histogram of rank 2, each
+// contribution adding to the 4 components of a bin. With few bins, the
+// contributions are contended; with as many bins as contributions, they are
+// not. The benchmarks are meant to be run with the OpenMP backend.
+
+using View = Kokkos::View<double **, Kokkos::DefaultHostExecutionSpace>;
+using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+constexpr std::int64_t contributions = std::int64_t(1) << 20;
+constexpr std::int64_t components = 4;
+
+// Bin of a contribution, scattered over the bins.
+KOKKOS_INLINE_FUNCTION std::int64_t get_bin(std::int64_t const contribution,
+                                            std::int64_t const bins) {
+  return (contribution * 7919) % bins;
+}
+
+void benchmark_scatter_wrapper_array_atomic(benchmark::State &state) {
+  std::int64_t const bins = state.range(0);
+  View histogram{"histogram", bins, components};
+  brak::WrapperArray histogramWrapper{histogram};
+  auto const histogramAtomic = histogramWrapper.atomic();
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_scatter_wrapper_array_atomic", Policy(0, contributions),
+        KOKKOS_LAMBDA(std::int64_t const contribution) {
+          auto bin = histogramAtomic[get_bin(contribution, bins)];
+          for (std::int64_t component = 0; component < components;
+               component++) {
+            bin[component] += 1;
+          }
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_scatter_wrapper_array_atomic)
+    ->Arg(16)
+    ->Arg(contributions);
+
+void benchmark_scatter_view_atomic(benchmark::State &state) {
+  std::int64_t const bins = state.range(0);
+  View histogram{"histogram", bins, components};
+  Kokkos::View<double **, Kokkos::DefaultHostExecutionSpace,
+               Kokkos::MemoryTraits<Kokkos::Atomic>>
+      histogramAtomic = histogram;
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_scatter_view_atomic", Policy(0, contributions),
+        KOKKOS_LAMBDA(std::int64_t const contribution) {
+          std::int64_t const bin = get_bin(contribution, bins);
+          for (std::int64_t component = 0; component < components;
+               component++) {
+            histogramAtomic(bin, component) += 1;
+          }
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_scatter_view_atomic)->Arg(16)->Arg(contributions);
+
+void benchmark_scatter_wrapper_scatter(benchmark::State &state) {
+  std::int64_t const bins = state.range(0);
+  View histogram{"histogram", bins, components};
+  brak::WrapperArray histogramWrapper{histogram};
+  auto histogramScatter = brak::scatter(histogramWrapper);
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_scatter_wrapper_scatter", Policy(0, contributions),
+        KOKKOS_LAMBDA(std::int64_t const contribution) {
+          auto access = histogramScatter.access();
+          auto bin = access[get_bin(contribution, bins)];
+          for (std::int64_t component = 0; component < components;
+               component++) {
+            bin[component] += 1;
+          }
+        });
+    histogramScatter.contribute();
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_scatter_wrapper_scatter)->Arg(16)->Arg(contributions);
+
+void benchmark_scatter_scatter_view(benchmark::State &state) {
+  std::int64_t const bins = state.range(0);
+  View histogram{"histogram", bins, components};
+  Kokkos::Experimental::ScatterView<double **, Kokkos::LayoutRight,
+                                    Kokkos::DefaultHostExecutionSpace>
+      histogramScatter(histogram);
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_scatter_scatter_view", Policy(0, contributions),
+        KOKKOS_LAMBDA(std::int64_t const contribution) {
+          auto access = histogramScatter.access();
+          std::int64_t const bin = get_bin(contribution, bins);
+          for (std::int64_t component = 0; component < components;
+               component++) {
+            access(bin, component) += 1;
+          }
+        });
+    Kokkos::Experimental::contribute(histogram, histogramScatter);
+    histogramScatter.reset();
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_scatter_scatter_view)->Arg(16)->Arg(contributions);
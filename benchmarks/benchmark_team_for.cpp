@@ -0,0 +1,115 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/scratch.hpp>
+#include <brak/wrapper_array.hpp>
+
+// Time step of the heat equation on a field of rank 3, with a 7-point
+// stencil, either with a flat multi-dimensional range policy as in the
+// parallel-for benchmark, or with a team policy where each team caches a
+// tile of the field and its halo in scratch memory. The interior of the
+// field is a whole number of tiles.
+
+using View = Kokkos::View<double ***>;
+using Policy = Kokkos::TeamPolicy<>;
+using Member = typename Policy::member_type;
+
+constexpr double alpha = 0.1;
+constexpr std::int64_t tile = 8;
+constexpr std::int64_t tileHalo = tile + 2;
+
+// Tile with its halo, cached in scratch memory.
+using Tile = double[tileHalo][tileHalo][tileHalo];
+
+void benchmark_heat_wrapper_array_md_range(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  View field{"field", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_heat_wrapper_array_md_range",
+        Kokkos::MDRangePolicy<Kokkos::Rank<3>>({1, 1, 1},
+                                               {size - 1, size - 1, size - 1}),
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k) {
+          fieldTempWrapper[i][j][k] =
+              fieldWrapper[i][j][k] +
+              alpha *
+                  (fieldWrapper[i - 1][j][k] + fieldWrapper[i + 1][j][k] +
+                   fieldWrapper[i][j - 1][k] + fieldWrapper[i][j + 1][k] +
+                   fieldWrapper[i][j][k - 1] + fieldWrapper[i][j][k + 1] -
+                   6 * fieldWrapper[i][j][k]);
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_heat_wrapper_array_md_range)->Arg(66)->Arg(258)->Arg(514);
+
+void benchmark_heat_wrapper_array_team_scratch(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  std::int64_t const tiles = (size - 2) / tile;
+  View field{"field", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_heat_wrapper_array_team_scratch",
+        Policy(tiles * tiles * tiles, Kokkos::AUTO)
+            .set_scratch_size(0, Kokkos::PerTeam(brak::scratch_size<Tile>())),
+        KOKKOS_LAMBDA(Member const &team) {
+          auto cache = brak::make_scratch_wrapper<Tile>(team);
+
+          // origin of the tile, including its halo
+          std::int64_t const league = team.league_rank();
+          std::int64_t const i0 = league / (tiles * tiles) * tile;
+          std::int64_t const j0 = league / tiles % tiles * tile;
+          std::int64_t const k0 = league % tiles * tile;
+
+          // load the tile and its halo
+          Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team, tileHalo * tileHalo),
+              [&](std::int64_t const ij) {
+                std::int64_t const i = ij / tileHalo;
+                std::int64_t const j = ij % tileHalo;
+                Kokkos::parallel_for(
+                    Kokkos::ThreadVectorRange(team, tileHalo),
+                    [&](std::int64_t const k) {
+                      cache[i][j][k] = fieldWrapper[i0 + i][j0 + j][k0 + k];
+                    });
+              });
+          team.team_barrier();
+
+          // compute the tile from the cache
+          Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team, tile * tile),
+              [&](std::int64_t const ij) {
+                std::int64_t const i = ij / tile + 1;
+                std::int64_t const j = ij % tile + 1;
+                Kokkos::parallel_for(
+                    Kokkos::ThreadVectorRange(team, 1, tile + 1),
+                    [&](std::int64_t const k) {
+                      fieldTempWrapper[i0 + i][j0 + j][k0 + k] =
+                          cache[i][j][k] +
+                          alpha * (cache[i - 1][j][k] + cache[i + 1][j][k] +
+                                   cache[i][j - 1][k] + cache[i][j + 1][k] +
+                                   cache[i][j][k - 1] + cache[i][j][k + 1] -
+                                   6 * cache[i][j][k]);
+                    });
+              });
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_heat_wrapper_array_team_scratch)
+    ->Arg(66)
+    ->Arg(258)
+    ->Arg(514);
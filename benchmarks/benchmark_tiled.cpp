@@ -0,0 +1,100 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include <brak/wrapper_array.hpp>
+
+// Time step of the heat equation on a field of rank 3, with a 7-point
+// stencil, for fields stored with a right layout or by tiles.
+
+using View = Kokkos::View<double ***>;
+
+constexpr double alpha = 0.1;
+
+// Compute a time step of the heat equation with wrappers.
+template <typename Wrapper>
+void heat_step(Wrapper const &fieldWrapper, Wrapper const &fieldTempWrapper,
+               std::int64_t const size) {
+  Kokkos::parallel_for(
+      "heat_step",
+      Kokkos::MDRangePolicy<Kokkos::Rank<3>>({1, 1, 1},
+                                             {size - 1, size - 1, size - 1}),
+      KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                    std::int64_t const k) {
+        fieldTempWrapper[i][j][k] =
+            fieldWrapper[i][j][k] +
+            alpha * (fieldWrapper[i - 1][j][k] + fieldWrapper[i + 1][j][k] +
+                     fieldWrapper[i][j - 1][k] + fieldWrapper[i][j + 1][k] +
+                     fieldWrapper[i][j][k - 1] + fieldWrapper[i][j][k + 1] -
+                     6 * fieldWrapper[i][j][k]);
+      });
+  Kokkos::fence();
+}
+
+void benchmark_heat_view(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  View field{"field", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+
+  while (state.KeepRunning()) {
+    Kokkos::parallel_for(
+        "benchmark_heat_view",
+        Kokkos::MDRangePolicy<Kokkos::Rank<3>>({1, 1, 1},
+                                               {size - 1, size - 1, size - 1}),
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k) {
+          fieldTemp(i, j, k) =
+              field(i, j, k) +
+              alpha * (field(i - 1, j, k) + field(i + 1, j, k) +
+                       field(i, j - 1, k) + field(i, j + 1, k) +
+                       field(i, j, k - 1) + field(i, j, k + 1) -
+                       6 * field(i, j, k));
+        });
+    Kokkos::fence();
+  }
+}
+
+BENCHMARK(benchmark_heat_view)->Arg(64)->Arg(256)->Arg(512);
+
+void benchmark_heat_wrapper_array(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  View field{"field", size, size, size};
+  View fieldTemp{"fieldTemp", size, size, size};
+  brak::WrapperArray fieldWrapper{field};
+  brak::WrapperArray fieldTempWrapper{fieldTemp};
+
+  while (state.KeepRunning()) {
+    heat_step(fieldWrapper, fieldTempWrapper, size);
+  }
+}
+
+BENCHMARK(benchmark_heat_wrapper_array)->Arg(64)->Arg(256)->Arg(512);
+
+void benchmark_heat_wrapper_tiled_8_8_8(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  auto fieldWrapper =
+      brak::create_wrapper_tiled<View, 8, 8, 8>("field", size, size, size);
+  auto fieldTempWrapper =
+      brak::create_wrapper_tiled<View, 8, 8, 8>("fieldTemp", size, size, size);
+
+  while (state.KeepRunning()) {
+    heat_step(fieldWrapper, fieldTempWrapper, size);
+  }
+}
+
+BENCHMARK(benchmark_heat_wrapper_tiled_8_8_8)->Arg(64)->Arg(256)->Arg(512);
+
+void benchmark_heat_wrapper_tiled_4_4_32(benchmark::State &state) {
+  std::int64_t const size = state.range(0);
+  auto fieldWrapper =
+      brak::create_wrapper_tiled<View, 4, 4, 32>("field", size, size, size);
+  auto fieldTempWrapper = brak::create_wrapper_tiled<View, 4, 4, 32>(
+      "fieldTemp", size, size, size);
+
+  while (state.KeepRunning()) {
+    heat_step(fieldWrapper, fieldTempWrapper, size);
+  }
+}
+
+BENCHMARK(benchmark_heat_wrapper_tiled_4_4_32)->Arg(64)->Arg(256)->Arg(512);
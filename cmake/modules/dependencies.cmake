@@ -41,6 +41,10 @@ if(BRAK_ENABLE_BENCHMARKS)
     endif()
 endif()
 
+if(BRAK_ENABLE_COMPILE_BENCHMARKS OR BRAK_ENABLE_CODEGEN_TESTS)
+    find_package(Python3 3.8 REQUIRED COMPONENTS Interpreter)
+endif()
+
 if(BRAK_ENABLE_DOCUMENTATION)
     find_package(Doxygen 1.9.1 REQUIRED QUIET)
 
@@ -10,6 +10,24 @@ install(
         "${CMAKE_INSTALL_LIBDIR}"
 )
 
+if(BRAK_ENABLE_PREBUILT)
+    install(
+        TARGETS
+            brak_prebuilt
+        EXPORT
+            BrakTargets
+        ARCHIVE DESTINATION
+            "${CMAKE_INSTALL_LIBDIR}"
+        LIBRARY DESTINATION
+            "${CMAKE_INSTALL_LIBDIR}"
+    )
+
+    # the prebuilt library depends on the architecture
+    set(BRAK_VERSION_ARCH_INDEPENDENT "")
+else()
+    set(BRAK_VERSION_ARCH_INDEPENDENT ARCH_INDEPENDENT)
+endif()
+
 install(
     EXPORT
         BrakTargets
@@ -30,7 +48,7 @@ write_basic_package_version_file(
     "${CMAKE_CURRENT_BINARY_DIR}/BrakConfigVersion.cmake"
     VERSION ${CMAKE_PROJECT_VERSION}
     COMPATIBILITY SameMajorVersion
-    ARCH_INDEPENDENT
+    ${BRAK_VERSION_ARCH_INDEPENDENT}
 )
 
 install(
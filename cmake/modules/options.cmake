@@ -4,6 +4,15 @@ option(BRAK_ENABLE_TESTS "Build tests for the library")
 # allow gtest to discover tests
 option(BRAK_ENABLE_GTEST_DISCOVER_TESTS "Enable Gtest to discover tests by attempting to run them" ON)
 
+# bounds checking
+option(BRAK_ENABLE_BOUNDS_CHECK "Check the indices of the accesses to the wrappers against the extents of the views")
+
+# access profiling
+option(BRAK_ENABLE_PROFILING "Profile the accesses to the wrappers and dump a summary at the finalization of Kokkos")
+
+# prebuilt library
+option(BRAK_ENABLE_PREBUILT "Build a library with explicit instantiations of the wrappers for common views, to reduce the compilation time of client code")
+
 # examples
 option(BRAK_ENABLE_EXAMPLES "Build examples of the library")
 
@@ -12,6 +21,14 @@ option(BRAK_ENABLE_BENCHMARKS "Build benchmarks of the library")
 
 # compile benchmarks
 option(BRAK_ENABLE_COMPILE_BENCHMARKS "Build compile benchmarks of the library")
+set(BRAK_COMPILE_BENCHMARKS_ACCESSES 16 CACHE STRING "Number of access sites in each generated compile benchmark")
+set(BRAK_COMPILE_BENCHMARKS_REPEAT 3 CACHE STRING "Number of compilations of each generated compile benchmark, the shortest one being kept")
+set(BRAK_COMPILE_BENCHMARKS_BASELINE "" CACHE FILEPATH "Results of the generated compile benchmarks to compare with")
+set(BRAK_COMPILE_BENCHMARKS_THRESHOLD 1.1 CACHE STRING "Maximum ratio of the compilation time to the baseline before failing")
+
+# codegen tests
+option(BRAK_ENABLE_CODEGEN_TESTS "Check that accesses to the wrappers compile to no more machine code than accesses to views")
+set(BRAK_CODEGEN_TESTS_THRESHOLD 1 CACHE STRING "Maximum ratio of the instructions and of the memory operations of an access to a wrapper to the ones of an access to a view")
 
 # documentation
 option(BRAK_ENABLE_DOCUMENTATION "Build documentation of the library")
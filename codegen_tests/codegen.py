@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Compare the machine code of accesses to wrappers and to views.
+
+The generated kernels of the object files are disassembled with objdump. For
+each wrapper and each rank, the kernel storing through the wrapper must not
+have more calls than the kernel storing through the view, and must not have
+more instructions or memory operations than the ones of the view kernel
+multiplied by a threshold, otherwise the comparison fails.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+from collections import defaultdict
+
+SYMBOL_PATTERN = re.compile(
+    r"^[0-9a-f]+ <brak_codegen_(?P<implementation>\w+)_rank(?P<rank>\d+)"
+    r"(?P<part>\.[\w.]+)?>:$"
+)
+INSTRUCTION_PATTERN = re.compile(r"^\s*[0-9a-f]+:\s+(?P<instruction>.+)$")
+CALL_MNEMONICS = ("call", "callq", "bl", "blr", "jal", "jalr")
+METRICS = ("instructions", "calls", "memory")
+
+
+def classify(instruction):
+    """Get the metrics of an instruction, or None if it is padding."""
+    parts = instruction.split(None, 1)
+    mnemonic = parts[0]
+    operands = parts[1] if len(parts) > 1 else ""
+
+    # alignment padding is not executed
+    if "nop" in mnemonic or instruction.strip() == "xchg   %ax,%ax":
+        return None
+
+    # memory operands are between parentheses in the AT&T syntax of x86, and
+    # between brackets on other architectures, but `lea` does not access them
+    memory = mnemonic != "lea" and ("(" in operands or "[" in operands)
+
+    return {
+        "instructions": 1,
+        "calls": 1 if mnemonic in CALL_MNEMONICS else 0,
+        "memory": 1 if memory else 0,
+    }
+
+
+def disassemble(objdump, path):
+    """Get the metrics of the kernels of an object file."""
+    output = subprocess.run(
+        [objdump, "--disassemble", "--no-show-raw-insn", path],
+        capture_output=True,
+        text=True,
+        check=True,
+    ).stdout
+
+    kernels = defaultdict(lambda: dict.fromkeys(METRICS, 0))
+    current = None
+    for line in output.splitlines():
+        match = SYMBOL_PATTERN.match(line)
+        if match:
+            # parts split by the compiler, like `.cold`, count for the kernel
+            current = (match.group("implementation"), int(match.group("rank")))
+            continue
+
+        if not line.strip() or line.endswith(">:"):
+            current = None
+            continue
+
+        match = INSTRUCTION_PATTERN.match(line)
+        if current is None or not match:
+            continue
+
+        metrics = classify(match.group("instruction").split("#")[0].strip())
+        if metrics is None:
+            continue
+
+        for metric in METRICS:
+            kernels[current][metric] += metrics[metric]
+
+    return kernels
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--objdump", default="objdump", help="Objdump program")
+    parser.add_argument(
+        "--label", default="", help="Label of the comparison, like the flags"
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=1.0,
+        help="Maximum ratio of the instructions and of the memory operations "
+        "of a wrapper kernel to the ones of the view kernel",
+    )
+    parser.add_argument("objects", nargs="+", help="Object files of the kernels")
+    arguments = parser.parse_args()
+
+    kernels = {}
+    for path in arguments.objects:
+        kernels.update(disassemble(arguments.objdump, path))
+
+    if not kernels:
+        print("No kernels found in the object files")
+        return 1
+
+    print(
+        f"{'Kernel ' + arguments.label:<32} {'Instr.':>7} {'Calls':>6} "
+        f"{'Memory':>7} {'View instr.':>12} {'View calls':>11} "
+        f"{'View memory':>12}"
+    )
+
+    regressions = []
+    for (implementation, rank), metrics in sorted(kernels.items()):
+        if implementation == "view":
+            continue
+
+        reference = kernels.get(("view", rank))
+        if reference is None:
+            print(f"No view kernel of rank {rank} to compare with")
+            return 1
+
+        name = f"{implementation}_rank{rank}"
+        print(
+            f"{name:<32} {metrics['instructions']:>7} {metrics['calls']:>6} "
+            f"{metrics['memory']:>7} {reference['instructions']:>12} "
+            f"{reference['calls']:>11} {reference['memory']:>12}"
+        )
+
+        # a call means that the access is not inlined, whatever its size
+        worse = [
+            metric
+            for metric in METRICS
+            if metrics[metric]
+            > reference[metric] * (1 if metric == "calls" else arguments.threshold)
+        ]
+        if worse:
+            regressions.append(f"{name} ({', '.join(worse)})")
+
+    if regressions:
+        print(
+            "Accesses to wrappers compile to more code than accesses to views "
+            f"for: {'; '.join(regressions)}"
+        )
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
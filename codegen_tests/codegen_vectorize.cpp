@@ -0,0 +1,79 @@
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+#include <brak/aliasing.hpp>
+#include <brak/wrapper_array.hpp>
+#include <brak/wrapper_subview.hpp>
+
+using View = Kokkos::View<double ***, Kokkos::HostSpace>;
+
+// NOTE The loops marked with `vectorize` must be reported as vectorized by
+// the compiler, without being versioned for possible aliasing. The inner loop
+// of each kernel reads from a read-only wrapper and writes to a restrict
+// wrapper of a distinct view. The loop marked with `versioned` is a control
+// over plain wrappers, which the compiler can only vectorize behind a runtime
+// aliasing check.
+
+extern "C" void
+brak_vectorize_array(brak::WrapperArray<View> const &dataWrapper,
+                     brak::WrapperArray<View> const &dataTempWrapper,
+                     double const coeff) {
+  auto const dataReadonly = brak::readonly(dataWrapper);
+  auto const dataTempRestrict = brak::restrict(dataTempWrapper);
+  std::size_t const extent = dataWrapper.getExtent(2);
+
+  for (std::size_t i = 1; i < dataWrapper.getExtent(0) - 1; i++)
+    for (std::size_t j = 1; j < dataWrapper.getExtent(1) - 1; j++) {
+      auto const center = dataReadonly[i][j];
+      auto const north = dataReadonly[i - 1][j];
+      auto const south = dataReadonly[i + 1][j];
+      auto const west = dataReadonly[i][j - 1];
+      auto const east = dataReadonly[i][j + 1];
+      auto const out = dataTempRestrict[i][j];
+
+      for (std::size_t k = 1; k < extent - 1; k++) { // vectorize
+        out[k] = center[k] + coeff * (-6 * center[k] + north[k] + south[k] +
+                                      west[k] + east[k] + center[k - 1] +
+                                      center[k + 1]);
+      }
+    }
+}
+
+extern "C" void
+brak_vectorize_subview(brak::WrapperSubview<View> const &dataWrapper,
+                       brak::WrapperSubview<View> const &dataTempWrapper,
+                       double const coeff) {
+  auto const dataReadonly = brak::readonly(dataWrapper);
+  auto const dataTempRestrict = brak::restrict(dataTempWrapper);
+  std::size_t const extent = dataWrapper.getExtent(2);
+
+  for (std::size_t i = 1; i < dataWrapper.getExtent(0) - 1; i++)
+    for (std::size_t j = 1; j < dataWrapper.getExtent(1) - 1; j++) {
+      auto const center = dataReadonly[i][j];
+      auto const out = dataTempRestrict[i][j];
+
+      for (std::size_t k = 1; k < extent - 1; k++) { // vectorize
+        out[k] = center[k] + coeff * (center[k - 1] - 2 * center[k] +
+                                      center[k + 1]);
+      }
+    }
+}
+
+extern "C" void
+brak_vectorize_control(brak::WrapperSubview<View> const &dataWrapper,
+                       brak::WrapperSubview<View> const &dataTempWrapper,
+                       double const coeff) {
+  std::size_t const extent = dataWrapper.getExtent(2);
+
+  for (std::size_t i = 1; i < dataWrapper.getExtent(0) - 1; i++)
+    for (std::size_t j = 1; j < dataWrapper.getExtent(1) - 1; j++) {
+      auto const center = dataWrapper[i][j];
+      auto const out = dataTempWrapper[i][j];
+
+      for (std::size_t k = 1; k < extent - 1; k++) { // versioned
+        out[k] = center[k] + coeff * (center[k - 1] - 2 * center[k] +
+                                      center[k + 1]);
+      }
+    }
+}
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Check that loops are reported as vectorized by the compiler.
+
+The loops to check are marked in a source file by a `// vectorize` comment on
+the line of the loop. They must be vectorized without being versioned for
+possible aliasing, that is without a runtime check that the restrict
+qualifiers should have removed. The control loops, marked by a `// versioned`
+comment, must be versioned, which shows that the report detects versioning.
+The vectorization report is the text output of `-fopt-info-vec-optimized` of
+GCC.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MARKER_PATTERN = re.compile(r"//\s*vectorize\b")
+CONTROL_PATTERN = re.compile(r"//\s*versioned\b")
+GCC_PATTERN = re.compile(
+    r"^(?P<file>[^:\s]+):(?P<line>\d+):\d+: optimized: loop vectorized",
+    re.MULTILINE,
+)
+GCC_VERSIONED_PATTERN = re.compile(
+    r"^(?P<file>[^:\s]+):(?P<line>\d+):\d+: optimized:\s+loop versioned for "
+    r"vectorization because of possible aliasing",
+    re.MULTILINE,
+)
+
+
+def get_marked_lines(source, pattern):
+    """Get the numbers of the lines marked by a pattern in a source file."""
+    with open(source, encoding="utf-8") as file:
+        return [
+            number
+            for number, line in enumerate(file, start=1)
+            if pattern.search(line)
+        ]
+
+
+def get_reported_lines(content, source, patterns):
+    """Get the numbers of the lines of a source file matched in a report."""
+    name = os.path.basename(source)
+    return {
+        int(match.group("line"))
+        for pattern in patterns
+        for match in pattern.finditer(content)
+        if os.path.basename(match.group("file")) == name
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--report", required=True, help="Vectorization report")
+    parser.add_argument("source", help="Source file with marked loops")
+    arguments = parser.parse_args()
+
+    marked = get_marked_lines(arguments.source, MARKER_PATTERN)
+    controls = get_marked_lines(arguments.source, CONTROL_PATTERN)
+    if not marked or not controls:
+        print("No loops or no control loops marked in the source file")
+        return 1
+
+    with open(arguments.report, encoding="utf-8") as file:
+        content = file.read()
+
+    vectorized = get_reported_lines(content, arguments.source, (GCC_PATTERN,))
+    # a loop versioned for aliasing is vectorized, but behind a runtime check
+    # that the restrict qualifiers did not remove
+    versioned = get_reported_lines(
+        content, arguments.source, (GCC_VERSIONED_PATTERN,)
+    )
+    missed = [
+        line for line in marked if line not in vectorized or line in versioned
+    ]
+    # a control loop that is not versioned means that the report cannot tell
+    # the versioned loops apart
+    missed_controls = [line for line in controls if line not in versioned]
+
+    for line in sorted(marked + controls):
+        if line not in vectorized:
+            status = "missed"
+        elif line in versioned:
+            status = "vectorized (versioned for possible aliasing)"
+        else:
+            status = "vectorized"
+        if line in controls:
+            status += " (control)"
+        print(f"{os.path.basename(arguments.source)}:{line}: {status}")
+
+    if missed:
+        print(
+            "Loops are not vectorized without versioning at lines: "
+            f"{', '.join(str(line) for line in missed)}"
+        )
+    if missed_controls:
+        print(
+            "Control loops are not versioned at lines: "
+            f"{', '.join(str(line) for line in missed_controls)}"
+        )
+
+    return 1 if missed or missed_controls else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,10 @@
+#include <Kokkos_Core.hpp>
+
+#include <brak/wrapper_offset.hpp>
+
+void benchmarkSetWrapper() {
+  Kokkos::View<int ********> data{"data", 2, 2, 2, 2, 2, 2, 2, 2};
+  brak::WrapperOffset dataWrapper{data};
+
+  dataWrapper[1][1][1][1][1][1][1][1] = 10;
+}
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""Measure the compilation time of the generated compile benchmarks.
+
+The `launch` command is used as a compiler launcher: it runs the compile
+command several times, keeps the shortest wall time, and counts the template
+instantiations of the translation unit. The `report` command gathers the
+results, compares them with a baseline, and fails if the compilation time
+regressed past a threshold.
+"""
+
+import argparse
+import json
+import re
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+NAMESPACES = ("brak::", "kokkos_addendum::")
+NAME_PATTERN = re.compile(r"compile_benchmark_(?P<wrapper>\w+)_rank(?P<rank>\d+)")
+
+
+def get_output(command):
+    """Get the path of the object file of a compile command."""
+    for index, argument in enumerate(command[:-1]):
+        if argument == "-o":
+            return Path(command[index + 1])
+
+    raise ValueError("No output file in the compile command")
+
+
+def is_clang(compiler):
+    """Check if the compiler is Clang."""
+    try:
+        version = subprocess.run(
+            [compiler, "--version"], capture_output=True, text=True, check=False
+        ).stdout
+    except OSError:
+        return False
+
+    return "clang" in version
+
+
+def count_instantiations_clang(trace_path):
+    """Count the template instantiations from a Clang time trace."""
+    if not trace_path.exists():
+        return 0, 0
+
+    trace = json.loads(trace_path.read_text())
+    count_total = 0
+    count_library = 0
+    for event in trace.get("traceEvents", []):
+        if event.get("name") not in ("InstantiateClass", "InstantiateFunction"):
+            continue
+
+        count_total += 1
+        detail = event.get("args", {}).get("detail", "")
+        if detail.startswith(NAMESPACES):
+            count_library += 1
+
+    return count_total, count_library
+
+
+def count_instantiations_symbols(object_path):
+    """Count the instantiated functions from the symbols of an object file.
+
+    This is used when no time trace is available. In debug mode, each
+    instantiated function is emitted in the object file.
+    """
+    symbols = subprocess.run(
+        ["nm", "--demangle", "--defined-only", str(object_path)],
+        capture_output=True,
+        text=True,
+        check=False,
+    ).stdout.splitlines()
+    count_total = sum(1 for symbol in symbols if "<" in symbol)
+    count_library = sum(
+        1 for symbol in symbols if any(name in symbol for name in NAMESPACES)
+    )
+
+    return count_total, count_library
+
+
+def parse_time_report(report):
+    """Get the template instantiation time from a GCC time report."""
+    for line in report.splitlines():
+        if line.strip().startswith("template instantiation"):
+            # the wall time is the third number of the line
+            numbers = re.findall(r"(\d+\.\d+)\s*\(", line)
+            if len(numbers) >= 3:
+                return float(numbers[2])
+
+    return None
+
+
+def launch(arguments):
+    """Run and measure a compile command."""
+    command = arguments.command
+    if command and command[0] == "--":
+        command = command[1:]
+
+    output = get_output(command)
+    clang = is_clang(command[0])
+    command_measured = command + (["-ftime-trace"] if clang else ["-ftime-report"])
+
+    time_best = None
+    for _ in range(arguments.repeat):
+        time_start = time.perf_counter()
+        process = subprocess.run(
+            command_measured, capture_output=True, text=True, check=False
+        )
+        time_elapsed = time.perf_counter() - time_start
+
+        if process.returncode != 0:
+            sys.stdout.write(process.stdout)
+            sys.stderr.write(process.stderr)
+            return process.returncode
+
+        if time_best is None or time_elapsed < time_best:
+            time_best = time_elapsed
+
+    # strip the extensions of the source and of the object file
+    name = output.name.split(".")[0]
+    match = NAME_PATTERN.search(name)
+    if not match:
+        # other files, like precompiled headers, are named after their target
+        name = f"{output.parent.name.split('.')[0]}_{name}"
+
+    result = {"name": name, "time": time_best}
+    if match:
+        result["wrapper"] = match.group("wrapper")
+        result["rank"] = int(match.group("rank"))
+
+    if clang:
+        trace_path = output.with_suffix(".json")
+        result["instantiations"], result["instantiations_library"] = (
+            count_instantiations_clang(trace_path)
+        )
+    else:
+        result["instantiations"], result["instantiations_library"] = (
+            count_instantiations_symbols(output)
+        )
+        result["time_instantiation"] = parse_time_report(process.stderr)
+
+    output_dir = Path(arguments.output_dir)
+    output_dir.mkdir(parents=True, exist_ok=True)
+    (output_dir / f"{name}.json").write_text(json.dumps(result, indent=2))
+
+    return 0
+
+
+def report(arguments):
+    """Gather the results, and compare them with a baseline."""
+    results = {}
+    for path in sorted(Path(arguments.input_dir).glob("*.json")):
+        result = json.loads(path.read_text())
+        results[result["name"]] = result
+
+    if not results:
+        print("No results found, build the compile benchmarks first")
+        return 1
+
+    baseline = {}
+    if arguments.baseline:
+        baseline = json.loads(Path(arguments.baseline).read_text())
+
+    print(
+        f"{'Benchmark':<48} {'Time (s)':>10} {'Baseline':>10} {'Ratio':>7} "
+        f"{'Inst.':>7} {'Inst. lib.':>10}"
+    )
+
+    regressions = []
+    for name, result in sorted(
+        results.items(),
+        key=lambda item: (item[1].get("wrapper", ""), item[1].get("rank", 0)),
+    ):
+        time_baseline = baseline.get(name, {}).get("time")
+        ratio = result["time"] / time_baseline if time_baseline else None
+        if ratio is not None and ratio > arguments.threshold:
+            regressions.append(name)
+
+        print(
+            f"{name:<48} {result['time']:>10.3f} "
+            f"{time_baseline if time_baseline else float('nan'):>10.3f} "
+            f"{ratio if ratio else float('nan'):>7.2f} "
+            f"{result['instantiations']:>7} {result['instantiations_library']:>10}"
+        )
+
+    if arguments.output:
+        Path(arguments.output).write_text(json.dumps(results, indent=2))
+
+    if regressions:
+        print(
+            f"Compilation time regressed past {arguments.threshold} times the "
+            f"baseline for: {', '.join(regressions)}"
+        )
+        return 1
+
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    subparsers = parser.add_subparsers(dest="action", required=True)
+
+    parser_launch = subparsers.add_parser("launch", help="Measure a compile command")
+    parser_launch.add_argument(
+        "--output-dir", required=True, help="Directory of the results"
+    )
+    parser_launch.add_argument(
+        "--repeat", type=int, default=3, help="Number of compilations"
+    )
+    parser_launch.add_argument(
+        "command", nargs=argparse.REMAINDER, help="Compile command"
+    )
+    parser_launch.set_defaults(function=launch)
+
+    parser_report = subparsers.add_parser("report", help="Report the results")
+    parser_report.add_argument(
+        "--input-dir", required=True, help="Directory of the results"
+    )
+    parser_report.add_argument("--output", help="File to store the results in")
+    parser_report.add_argument("--baseline", help="File of the results to compare with")
+    parser_report.add_argument(
+        "--threshold",
+        type=float,
+        default=1.1,
+        help="Maximum ratio of the compilation time to the baseline",
+    )
+    parser_report.set_defaults(function=report)
+
+    arguments = parser.parse_args()
+    return arguments.function(arguments)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,82 @@
+#include <Kokkos_Core.hpp>
+
+#include "brak/parallel.hpp"
+#include "brak/wrapper_array.hpp"
+
+#include "utils.hpp"
+
+using View = Kokkos::View<double ***, Kokkos::HostSpace>;
+using ViewWrapped = brak::WrapperArray<View>;
+
+void solve(ViewWrapped field, ViewWrapped fieldTemp,
+           unsigned const iterationMax, double const residualMin,
+           double const coeff, unsigned const sizeX, unsigned const sizeY,
+           unsigned const sizeZ) {
+  double residual = 10;
+
+  // initialize
+  brak::parallel_nest(
+      field, KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                           std::int64_t const k) {
+        field[i][j][k] = i == 0 ? 1 : 0;
+      });
+
+  // iteration loop
+  for (unsigned iteration = 1; iteration <= iterationMax; iteration++) {
+    // check residual
+    if (residual <= residualMin)
+      return;
+
+    // compute new field
+    brak::parallel_nest(
+        field, {1, 1, 1}, {sizeX - 1, sizeY - 1, sizeZ - 1},
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k) {
+          fieldTemp[i][j][k] =
+              field[i][j][k] +
+              coeff * (-6 * field[i][j][k] + field[i + 1][j][k] +
+                       field[i - 1][j][k] + field[i][j + 1][k] +
+                       field[i][j - 1][k] + field[i][j][k + 1] +
+                       field[i][j][k - 1]);
+        });
+    Kokkos::fence();
+
+    // compute residual
+    brak::transform_reduce(
+        fieldTemp, field, {1, 1, 1}, {sizeX - 1, sizeY - 1, sizeZ - 1},
+        KOKKOS_LAMBDA(double const valueTemp, double const value) {
+          return Kokkos::abs(valueTemp - value);
+        },
+        Kokkos::Max<double>(residual));
+
+    // swap fields
+    brak::parallel_nest(
+        field, {1, 1, 1}, {sizeX - 1, sizeY - 1, sizeZ - 1},
+        KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                      std::int64_t const k) {
+          field[i][j][k] = fieldTemp[i][j][k];
+        });
+
+    display(iteration, residual, 100);
+  }
+}
+
+int main() {
+  unsigned const sizeX = 50;
+  unsigned const sizeY = 50;
+  unsigned const sizeZ = 50;
+
+  double const coeff = 0.1;
+  unsigned const iterationMax = 10000;
+  double const residualMin = 1e-4;
+
+  Kokkos::ScopeGuard kokkos;
+
+  View field{"field", sizeX, sizeY, sizeZ};
+  View fieldTemp{"field_temp", sizeX, sizeY, sizeZ};
+  ViewWrapped fieldWrapped{field};
+  ViewWrapped fieldTempWrapped{fieldTemp};
+
+  solve(fieldWrapped, fieldTempWrapped, iterationMax, residualMin, coeff, sizeX,
+        sizeY, sizeZ);
+}
@@ -0,0 +1,53 @@
+#ifndef __BRAK_ALIASING_HPP__
+#define __BRAK_ALIASING_HPP__
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/kokkos_view.hpp"
+
+namespace brak {
+
+/**
+ * Get a read-only version of a wrapper or a view.
+ * Marking the inputs of a kernel as read-only tells the compiler that the
+ * kernel does not write to them, and enables read-only caches on GPU.
+ * @tparam ViewOrWrapper Type of the wrapper or the view (automatically
+ * deduced).
+ * @param object Array or subview wrapper, at any depth, or view.
+ * @return Wrapper of the same kind and indices, or unmanaged view, whose
+ * accesses return constant references.
+ */
+template <typename ViewOrWrapper>
+KOKKOS_FUNCTION auto readonly(ViewOrWrapper const &object) {
+  if constexpr (Kokkos::is_view<ViewOrWrapper>::value) {
+    return kokkos_addendum::make_unmanaged_readonly<ViewOrWrapper>(object);
+  } else {
+    return object.readonly();
+  }
+}
+
+/**
+ * Get a version of a wrapper or a view whose accesses are not aliased.
+ * In a loop that writes to one wrapper and reads from another one, this lets
+ * the compiler assume that the two do not overlap, so that the loop can be
+ * vectorized without runtime checks.
+ * @tparam ViewOrWrapper Type of the wrapper or the view (automatically
+ * deduced).
+ * @param object Array or subview wrapper, at any depth, or view.
+ * @return Wrapper of the same kind and indices, or unmanaged view, with the
+ * restrict memory trait.
+ * @note The data must not be accessed through any other view or wrapper in
+ * the same kernel, otherwise the behavior is undefined.
+ */
+template <typename ViewOrWrapper>
+KOKKOS_FUNCTION auto restrict(ViewOrWrapper const &object) {
+  if constexpr (Kokkos::is_view<ViewOrWrapper>::value) {
+    return kokkos_addendum::make_unmanaged_restrict<ViewOrWrapper>(object);
+  } else {
+    return object.restrict();
+  }
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_ALIASING_HPP__
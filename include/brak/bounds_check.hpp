@@ -0,0 +1,214 @@
+#ifndef __BRAK_BOUNDS_CHECK_HPP__
+#define __BRAK_BOUNDS_CHECK_HPP__
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+
+namespace brak {
+
+/**
+ * Report an out of bounds access to a view for given extents and abort, on
+ * host.
+ * @tparam View Type of the view (automatically deduced).
+ * @tparam IndexType Type of the indices (automatically deduced).
+ * @tparam ExtentType Type of the extents (automatically deduced).
+ * @tparam size Number of indices (automatically deduced).
+ * @param data Accessed view.
+ * @param indices Array of the indices of the access.
+ * @param extents Array of the extents the indices are checked against.
+ */
+template <typename View, typename IndexType, typename ExtentType,
+          std::size_t size>
+void report_out_of_bounds(View const &data,
+                          Kokkos::Array<IndexType, size> const &indices,
+                          Kokkos::Array<ExtentType, size> const &extents) {
+  std::ostringstream message;
+  message << "brak: out of bounds access to view \"" << data.label()
+          << "\" with indices (";
+  for (std::size_t dimension = 0; dimension < size; dimension++) {
+    message << (dimension > 0 ? ", " : "") << indices[dimension];
+  }
+  message << ") for extents (";
+  for (std::size_t dimension = 0; dimension < size; dimension++) {
+    message << (dimension > 0 ? ", " : "") << extents[dimension];
+  }
+  message << ")";
+
+  Kokkos::abort(message.str().c_str());
+}
+
+/**
+ * Report an out of bounds access to a view and abort, on host.
+ * @tparam View Type of the view (automatically deduced).
+ * @tparam IndexType Type of the indices (automatically deduced).
+ * @tparam size Number of indices (automatically deduced).
+ * @param data Accessed view.
+ * @param indices Array of the indices of the access.
+ */
+template <typename View, typename IndexType, std::size_t size>
+void report_out_of_bounds(View const &data,
+                          Kokkos::Array<IndexType, size> const &indices) {
+  Kokkos::Array<std::size_t, size> extents;
+  for (std::size_t dimension = 0; dimension < size; dimension++) {
+    extents[dimension] = data.extent(dimension);
+  }
+
+  report_out_of_bounds(data, indices, extents);
+}
+
+/**
+ * Report an invalid range of a view and abort, on host.
+ * @tparam View Type of the view (automatically deduced).
+ * @param data Sliced view.
+ * @param begin First index of the range (included).
+ * @param end Last index of the range (excluded).
+ * @param step Step between two indices of the range.
+ * @param extent Extent of the sliced dimension.
+ */
+template <typename View>
+void report_invalid_range(View const &data, std::size_t const begin,
+                          std::size_t const end, std::size_t const step,
+                          std::size_t const extent) {
+  std::ostringstream message;
+  message << "brak: invalid range of view \"" << data.label() << "\" from "
+          << begin << " to " << end << " with step " << step
+          << " for extent " << extent;
+
+  Kokkos::abort(message.str().c_str());
+}
+
+/**
+ * Check that indices are within the extents of a view, and abort otherwise.
+ * @tparam View Type of the view (automatically deduced).
+ * @tparam IndexType Type of the indices (automatically deduced).
+ * @tparam size Number of indices (automatically deduced).
+ * @param data Accessed view.
+ * @param indices Array of the indices of the access, starting from the
+ * left-most dimension of the view. There may be less indices than the rank
+ * of the view.
+ */
+template <typename View, typename IndexType, std::size_t size>
+KOKKOS_FUNCTION void
+check_bounds(View const &data, Kokkos::Array<IndexType, size> const &indices) {
+  static_assert(size <= View::rank(), "Too many indices");
+
+  for (std::size_t dimension = 0; dimension < size; dimension++) {
+    // NOTE A negative signed index becomes larger than any extent once
+    // converted.
+    if (static_cast<std::size_t>(indices[dimension]) >=
+        data.extent(dimension)) {
+      KOKKOS_IF_ON_HOST((report_out_of_bounds(data, indices);))
+      KOKKOS_IF_ON_DEVICE(
+          (Kokkos::abort("brak: out of bounds access to view");))
+    }
+  }
+}
+
+/**
+ * Check that indices are within the extents of a view, and abort otherwise.
+ * @tparam View Type of the view (automatically deduced).
+ * @tparam IndicesType Type of the indices (automatically deduced).
+ * @param data Accessed view.
+ * @param indices Pack of the indices of the access.
+ */
+template <typename View, typename... IndicesType>
+KOKKOS_FUNCTION void check_bounds(View const &data,
+                                  IndicesType const... indices) {
+  check_bounds(data, Kokkos::Array<std::size_t, sizeof...(indices)>{
+                         {static_cast<std::size_t>(indices)...}});
+}
+
+/**
+ * Check that indices are within given extents, and abort otherwise.
+ * The extents are the ones of a sliced wrapper, which can be smaller than the
+ * ones of the view.
+ * @tparam View Type of the view (automatically deduced).
+ * @tparam IndexType Type of the indices (automatically deduced).
+ * @tparam ExtentType Type of the extents (automatically deduced).
+ * @tparam size Number of indices (automatically deduced).
+ * @param data Accessed view.
+ * @param indices Array of the indices of the access.
+ * @param extents Array of the extents the indices are checked against.
+ */
+template <typename View, typename IndexType, typename ExtentType,
+          std::size_t size>
+KOKKOS_FUNCTION void
+check_extents(View const &data, Kokkos::Array<IndexType, size> const &indices,
+              Kokkos::Array<ExtentType, size> const &extents) {
+  for (std::size_t dimension = 0; dimension < size; dimension++) {
+    // NOTE A negative signed index becomes larger than any extent once
+    // converted.
+    if (static_cast<std::size_t>(indices[dimension]) >=
+        static_cast<std::size_t>(extents[dimension])) {
+      KOKKOS_IF_ON_HOST((report_out_of_bounds(data, indices, extents);))
+      KOKKOS_IF_ON_DEVICE(
+          (Kokkos::abort("brak: out of bounds access to view");))
+    }
+  }
+}
+
+/**
+ * Check that a range has a strictly positive step and is within an extent,
+ * and abort otherwise.
+ * @tparam View Type of the view (automatically deduced).
+ * @param data Sliced view.
+ * @param begin First index of the range (included).
+ * @param end Last index of the range (excluded).
+ * @param step Step between two indices of the range.
+ * @param extent Extent of the sliced dimension.
+ */
+template <typename View>
+KOKKOS_FUNCTION void check_range(View const &data, std::size_t const begin,
+                                 std::size_t const end, std::size_t const step,
+                                 std::size_t const extent) {
+  if (step == 0 || begin > end || end > extent) {
+    KOKKOS_IF_ON_HOST(
+        (report_invalid_range(data, begin, end, step, extent);))
+    KOKKOS_IF_ON_DEVICE((Kokkos::abort("brak: invalid range of view");))
+  }
+}
+
+} // namespace brak
+
+/**
+ * Check the indices of an access to a view when the library is built with
+ * `BRAK_ENABLE_BOUNDS_CHECK`, and do nothing otherwise.
+ * @param data Accessed view.
+ * @param ... Array or pack of the indices of the access.
+ */
+#ifdef BRAK_ENABLE_BOUNDS_CHECK
+#define BRAK_CHECK_BOUNDS(data, ...) ::brak::check_bounds(data, __VA_ARGS__)
+#else
+#define BRAK_CHECK_BOUNDS(data, ...) static_cast<void>(0)
+#endif
+
+/**
+ * Check the indices of an access to a sliced wrapper against its extents when
+ * the library is built with `BRAK_ENABLE_BOUNDS_CHECK`, and do nothing
+ * otherwise.
+ * @param data Accessed view.
+ * @param ... Arrays of the indices of the access and of the extents.
+ */
+#ifdef BRAK_ENABLE_BOUNDS_CHECK
+#define BRAK_CHECK_EXTENTS(data, ...) ::brak::check_extents(data, __VA_ARGS__)
+#else
+#define BRAK_CHECK_EXTENTS(data, ...) static_cast<void>(0)
+#endif
+
+/**
+ * Check a range slicing a view when the library is built with
+ * `BRAK_ENABLE_BOUNDS_CHECK`, and do nothing otherwise.
+ * @param data Sliced view.
+ * @param ... Begin, end and step of the range, and extent of the sliced
+ * dimension.
+ */
+#ifdef BRAK_ENABLE_BOUNDS_CHECK
+#define BRAK_CHECK_RANGE(data, ...) ::brak::check_range(data, __VA_ARGS__)
+#else
+#define BRAK_CHECK_RANGE(data, ...) static_cast<void>(0)
+#endif
+
+#endif // ifndef __BRAK_BOUNDS_CHECK_HPP__
@@ -0,0 +1,487 @@
+#ifndef __BRAK_EXPRESSION_HPP__
+#define __BRAK_EXPRESSION_HPP__
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/parallel.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_range.hpp"
+#include "brak/wrapper_subview.hpp"
+
+namespace brak {
+
+/**
+ * Check if a type is a wrapper usable in an expression, at any depth.
+ * @tparam Type Type to check.
+ */
+template <typename Type> struct is_expression_wrapper : std::false_type {};
+
+template <typename View, std::size_t depth, typename IndexType,
+          typename Tiles>
+struct is_expression_wrapper<WrapperArray<View, depth, IndexType, Tiles>>
+    : std::true_type {};
+
+template <typename View, std::size_t depth>
+struct is_expression_wrapper<WrapperSubview<View, depth>> : std::true_type {};
+
+template <typename View, std::size_t depth, typename IndexType>
+struct is_expression_wrapper<WrapperRange<View, depth, IndexType>>
+    : std::true_type {};
+
+/**
+ * Arithmetic operation of a node of an expression.
+ */
+enum class ExpressionOperation { plus, minus, multiplies, divides };
+
+/**
+ * Leaf of an expression reading the elements of a wrapper.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Wrapper> class ExpressionWrapper {
+  /**
+   * Wrapper to read.
+   */
+  Wrapper mWrapper;
+
+public:
+  /**
+   * Construct the leaf.
+   * @param wrapper Wrapper to read.
+   */
+  KOKKOS_FUNCTION
+  explicit ExpressionWrapper(Wrapper const &wrapper) : mWrapper(wrapper) {}
+
+  /**
+   * Get the rank of the expression.
+   * @return Rank of the wrapper.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return Wrapper::getRank(); }
+
+  /**
+   * Check if the extents of the expression match the ones of a wrapper.
+   * @tparam WrapperOther Type of the other wrapper (automatically deduced).
+   * @param wrapper Other wrapper.
+   * @return True if all the extents are equal.
+   */
+  template <typename WrapperOther>
+  bool hasExtents(WrapperOther const &wrapper) const {
+    for (std::size_t dimension = 0; dimension < getRank(); dimension++) {
+      if (mWrapper.getExtent(dimension) != wrapper.getExtent(dimension)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Evaluate the expression at a point.
+   * @tparam IndicesType Type of the indices.
+   * @param indices Pack of indices of the point.
+   * @return Element of the wrapper.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION decltype(auto)
+  operator()(IndicesType const... indices) const {
+    return mWrapper(indices...);
+  }
+};
+
+/**
+ * Leaf of an expression holding a scalar, broadcasted to every point.
+ * @tparam ValueType Type of the scalar.
+ */
+template <typename ValueType> class ExpressionScalar {
+  /**
+   * Scalar value.
+   */
+  ValueType mValue;
+
+public:
+  /**
+   * Construct the leaf.
+   * @param value Scalar value.
+   */
+  KOKKOS_FUNCTION
+  explicit ExpressionScalar(ValueType const value) : mValue(value) {}
+
+  /**
+   * Get the rank of the expression.
+   * @return 0, as a scalar matches any rank.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return 0; }
+
+  /**
+   * Check if the extents of the expression match the ones of a wrapper.
+   * @tparam WrapperOther Type of the other wrapper (automatically deduced).
+   * @param wrapper Other wrapper.
+   * @return Always true.
+   */
+  template <typename WrapperOther>
+  bool hasExtents([[maybe_unused]] WrapperOther const &wrapper) const {
+    return true;
+  }
+
+  /**
+   * Evaluate the expression at a point.
+   * @tparam IndicesType Type of the indices.
+   * @param indices Pack of indices of the point.
+   * @return Scalar value.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION ValueType
+  operator()([[maybe_unused]] IndicesType const... indices) const {
+    return mValue;
+  }
+};
+
+/**
+ * Node of an expression combining two sub-expressions element-wise.
+ * The node is only evaluated when assigned to a wrapper, so that no
+ * temporary array is created.
+ * @tparam operation Arithmetic operation of the node.
+ * @tparam Left Type of the left sub-expression.
+ * @tparam Right Type of the right sub-expression.
+ */
+template <ExpressionOperation operation, typename Left, typename Right>
+class ExpressionBinary {
+  /**
+   * Left sub-expression.
+   */
+  Left mLeft;
+
+  /**
+   * Right sub-expression.
+   */
+  Right mRight;
+  static_assert(Left::getRank() == 0 || Right::getRank() == 0 ||
+                    Left::getRank() == Right::getRank(),
+                "Rank mismatch");
+
+public:
+  /**
+   * Construct the node.
+   * @param left Left sub-expression.
+   * @param right Right sub-expression.
+   */
+  KOKKOS_FUNCTION
+  ExpressionBinary(Left const &left, Right const &right)
+      : mLeft(left), mRight(right) {}
+
+  /**
+   * Get the rank of the expression.
+   * @return Rank of the sub-expressions, ignoring scalars.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() {
+    return Left::getRank() > Right::getRank() ? Left::getRank()
+                                              : Right::getRank();
+  }
+
+  /**
+   * Check if the extents of the expression match the ones of a wrapper.
+   * @tparam WrapperOther Type of the other wrapper (automatically deduced).
+   * @param wrapper Other wrapper.
+   * @return True if the extents of both sub-expressions match.
+   */
+  template <typename WrapperOther>
+  bool hasExtents(WrapperOther const &wrapper) const {
+    return mLeft.hasExtents(wrapper) && mRight.hasExtents(wrapper);
+  }
+
+  /**
+   * Evaluate the expression at a point.
+   * @tparam IndicesType Type of the indices.
+   * @param indices Pack of indices of the point.
+   * @return Result of the operation on the values of the sub-expressions.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION auto operator()(IndicesType const... indices) const {
+    if constexpr (operation == ExpressionOperation::plus) {
+      return mLeft(indices...) + mRight(indices...);
+    } else if constexpr (operation == ExpressionOperation::minus) {
+      return mLeft(indices...) - mRight(indices...);
+    } else if constexpr (operation == ExpressionOperation::multiplies) {
+      return mLeft(indices...) * mRight(indices...);
+    } else {
+      return mLeft(indices...) / mRight(indices...);
+    }
+  }
+};
+
+/**
+ * Check if a type is a node or a leaf of an expression.
+ * @tparam Type Type to check.
+ */
+template <typename Type> struct is_expression : std::false_type {};
+
+template <typename Wrapper>
+struct is_expression<ExpressionWrapper<Wrapper>> : std::true_type {};
+
+template <typename ValueType>
+struct is_expression<ExpressionScalar<ValueType>> : std::true_type {};
+
+template <ExpressionOperation operation, typename Left, typename Right>
+struct is_expression<ExpressionBinary<operation, Left, Right>>
+    : std::true_type {};
+
+/**
+ * Check if a type can be an operand of an expression: an expression, a
+ * wrapper, or an arithmetic scalar.
+ * @tparam Type Type to check.
+ */
+template <typename Type>
+inline constexpr bool is_expression_operand_v =
+    is_expression<Type>::value || is_expression_wrapper<Type>::value ||
+    std::is_arithmetic_v<Type>;
+
+/**
+ * Check if two types can be the operands of an arithmetic operator creating
+ * an expression. At least one of them must be an expression or a wrapper.
+ * @tparam Left Type of the left operand.
+ * @tparam Right Type of the right operand.
+ */
+template <typename Left, typename Right>
+inline constexpr bool is_expression_operation_v =
+    is_expression_operand_v<Left> && is_expression_operand_v<Right> &&
+    !(std::is_arithmetic_v<Left> && std::is_arithmetic_v<Right>);
+
+/**
+ * Convert an operand to an expression.
+ * @tparam Operand Type of the operand (automatically deduced).
+ * @param operand Expression, wrapper or scalar.
+ * @return Expression itself, or leaf of the wrapper or of the scalar.
+ */
+template <typename Operand>
+KOKKOS_FUNCTION auto make_expression(Operand const &operand) {
+  if constexpr (is_expression<Operand>::value) {
+    return operand;
+  } else if constexpr (is_expression_wrapper<Operand>::value) {
+    return ExpressionWrapper<Operand>(operand);
+  } else {
+    return ExpressionScalar<Operand>(operand);
+  }
+}
+
+/**
+ * Type of the expression of an operand.
+ * @tparam Operand Type of the operand.
+ */
+template <typename Operand>
+using expression_t = decltype(make_expression(std::declval<Operand>()));
+
+/**
+ * Create a node of an expression from two operands.
+ * @tparam operation Arithmetic operation of the node.
+ * @tparam Left Type of the left operand (automatically deduced).
+ * @tparam Right Type of the right operand (automatically deduced).
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Node of the expression.
+ */
+template <ExpressionOperation operation, typename Left, typename Right>
+KOKKOS_FUNCTION
+    ExpressionBinary<operation, expression_t<Left>, expression_t<Right>>
+    make_expression_binary(Left const &left, Right const &right) {
+  return ExpressionBinary<operation, expression_t<Left>, expression_t<Right>>(
+      make_expression(left), make_expression(right));
+}
+
+/**
+ * Add two operands element-wise, lazily.
+ * @tparam Left Type of the left operand (automatically deduced).
+ * @tparam Right Type of the right operand (automatically deduced).
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Node of the expression.
+ */
+template <typename Left, typename Right,
+          std::enable_if_t<is_expression_operation_v<Left, Right>, int> = 0>
+KOKKOS_FUNCTION auto operator+(Left const &left, Right const &right) {
+  return make_expression_binary<ExpressionOperation::plus>(left, right);
+}
+
+/**
+ * Subtract two operands element-wise, lazily.
+ * @tparam Left Type of the left operand (automatically deduced).
+ * @tparam Right Type of the right operand (automatically deduced).
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Node of the expression.
+ */
+template <typename Left, typename Right,
+          std::enable_if_t<is_expression_operation_v<Left, Right>, int> = 0>
+KOKKOS_FUNCTION auto operator-(Left const &left, Right const &right) {
+  return make_expression_binary<ExpressionOperation::minus>(left, right);
+}
+
+/**
+ * Multiply two operands element-wise, lazily.
+ * @tparam Left Type of the left operand (automatically deduced).
+ * @tparam Right Type of the right operand (automatically deduced).
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Node of the expression.
+ */
+template <typename Left, typename Right,
+          std::enable_if_t<is_expression_operation_v<Left, Right>, int> = 0>
+KOKKOS_FUNCTION auto operator*(Left const &left, Right const &right) {
+  return make_expression_binary<ExpressionOperation::multiplies>(left, right);
+}
+
+/**
+ * Divide two operands element-wise, lazily.
+ * @tparam Left Type of the left operand (automatically deduced).
+ * @tparam Right Type of the right operand (automatically deduced).
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Node of the expression.
+ */
+template <typename Left, typename Right,
+          std::enable_if_t<is_expression_operation_v<Left, Right>, int> = 0>
+KOKKOS_FUNCTION auto operator/(Left const &left, Right const &right) {
+  return make_expression_binary<ExpressionOperation::divides>(left, right);
+}
+
+/**
+ * Functor of the assignment of an expression to a wrapper, called at each
+ * point of a loop nest.
+ * @tparam Wrapper Type of the assigned wrapper.
+ * @tparam Expression Type of the expression.
+ * @tparam IndexSequence Index sequence of the dimensions of the loop nest.
+ */
+template <typename Wrapper, typename Expression, typename IndexSequence>
+class ExpressionAssignFunctor;
+
+template <typename Wrapper, typename Expression, std::size_t... indexSequence>
+class ExpressionAssignFunctor<Wrapper, Expression,
+                              std::index_sequence<indexSequence...>> {
+  /**
+   * Assigned wrapper.
+   */
+  Wrapper mWrapper;
+
+  /**
+   * Expression to evaluate.
+   */
+  Expression mExpression;
+
+public:
+  /**
+   * Construct the functor.
+   * @param wrapper Assigned wrapper.
+   * @param expression Expression to evaluate.
+   */
+  ExpressionAssignFunctor(Wrapper const &wrapper,
+                          Expression const &expression)
+      : mWrapper(wrapper), mExpression(expression) {}
+
+  /**
+   * Assign the expression at a point.
+   * @param indices Pack of indices of the point.
+   */
+  KOKKOS_FUNCTION
+  void operator()(
+      typename nest_index<indexSequence>::type const... indices) const {
+    mWrapper(indices...) = mExpression(indices...);
+  }
+};
+
+/**
+ * Target of the assignment of an expression, created by `brak::expr`.
+ * Assigning an expression, a wrapper or a scalar to it evaluates the
+ * expression in a single parallel loop nest over the wrapper, following the
+ * layout of its view.
+ * @tparam Wrapper Type of the assigned wrapper.
+ */
+template <typename Wrapper> class ExpressionTarget {
+  /**
+   * Assigned wrapper.
+   */
+  Wrapper mWrapper;
+
+  /**
+   * Label of the kernel.
+   */
+  std::string mLabel;
+
+public:
+  /**
+   * Construct the target.
+   * @param wrapper Assigned wrapper.
+   * @param label Label of the kernel.
+   */
+  ExpressionTarget(Wrapper const &wrapper, std::string const &label)
+      : mWrapper(wrapper), mLabel(label) {}
+
+  /**
+   * Assign the elements of another target.
+   * @param other Other target, whose wrapper is read.
+   * @return Reference to the target.
+   * @note This copies the elements, and does not rebind the target.
+   */
+  ExpressionTarget &operator=(ExpressionTarget const &other) {
+    return *this = other.mWrapper;
+  }
+
+  /**
+   * Assign an expression, a wrapper or a scalar.
+   * The kernel is not fenced, as any Kokkos kernel.
+   * @tparam Operand Type of the operand (automatically deduced).
+   * @param operand Expression, wrapper or scalar.
+   * @return Reference to the target.
+   */
+  template <typename Operand,
+            std::enable_if_t<is_expression_operand_v<Operand>, int> = 0>
+  ExpressionTarget &operator=(Operand const &operand) {
+    using Expression = expression_t<Operand>;
+    Expression const expression = make_expression(operand);
+    static_assert(Expression::getRank() == 0 ||
+                      Expression::getRank() == Wrapper::getRank(),
+                  "Rank mismatch");
+
+    if (!expression.hasExtents(mWrapper)) {
+      Kokkos::abort("Extents of the expression do not match the extents of "
+                    "the assigned wrapper");
+    }
+
+    parallel_nest(
+        mLabel, mWrapper,
+        ExpressionAssignFunctor<Wrapper, Expression,
+                                std::make_index_sequence<Wrapper::getRank()>>(
+            mWrapper, expression));
+
+    return *this;
+  }
+};
+
+/**
+ * Create the target of the assignment of an expression to a wrapper.
+ * The elements of the wrapper are then assigned element-wise in a single
+ * fused kernel, as in `brak::expr(a[i]) = b[i] + coeff * c[i]`.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Array, range or subview wrapper, at any depth, of rank 1 to
+ * 6.
+ * @param label Label of the kernel.
+ * @return Target of the assignment.
+ */
+template <typename Wrapper>
+ExpressionTarget<Wrapper> expr(Wrapper const &wrapper,
+                               std::string const &label = "brak::expr") {
+  static_assert(is_expression_wrapper<Wrapper>::value,
+                "Expressions can only be assigned to array, range or "
+                "subview wrappers");
+
+  return ExpressionTarget<Wrapper>(wrapper, label);
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_EXPRESSION_HPP__
@@ -1,26 +1,356 @@
 #ifndef __BRAK_KOKKOS_VIEW_HPP__
 #define __BRAK_KOKKOS_VIEW_HPP__
 
+#include <type_traits>
+#include <utility>
+
 #include <Kokkos_Core.hpp>
 
 namespace kokkos_addendum {
 
+/**
+ * Memory traits of a view with the unmanaged memory trait added.
+ * @tparam View Source view.
+ * @tparam traitsAdded Other memory traits to add.
+ */
+template <typename View, unsigned traitsAdded = 0>
+using make_unmanaged_memory_traits = Kokkos::MemoryTraits<
+    Kokkos::Unmanaged | traitsAdded |
+    (View::traits::memory_traits::is_random_access ? Kokkos::RandomAccess
+                                                   : 0) |
+    (View::traits::memory_traits::is_atomic ? Kokkos::Atomic : 0) |
+    (View::traits::memory_traits::is_restrict ? Kokkos::Restrict : 0) |
+    (View::traits::memory_traits::is_aligned ? Kokkos::Aligned : 0)>;
+
 /**
  * Recreate a view with the unmanaged memory trait.
  * This should be updated to follow any update in Kokkos view structures.
  * @tparam View Source view.
+ * @tparam traitsAdded Other memory traits to add.
  */
-template <typename View>
+template <typename View, unsigned traitsAdded = 0>
 using make_unmanaged = Kokkos::View<
     typename View::traits::data_type, typename View::traits::array_layout,
     typename View::traits::device_type, typename View::traits::hooks_policy,
-    Kokkos::MemoryTraits<
-        Kokkos::Unmanaged |
-        (View::traits::memory_traits::is_random_access ? Kokkos::RandomAccess
-                                                       : 0) |
-        (View::traits::memory_traits::is_atomic ? Kokkos::Atomic : 0) |
-        (View::traits::memory_traits::is_restrict ? Kokkos::Restrict : 0) |
-        (View::traits::memory_traits::is_aligned ? Kokkos::Aligned : 0)>>;
+    make_unmanaged_memory_traits<View, traitsAdded>>;
+
+/**
+ * Recreate a view with the unmanaged and atomic memory traits.
+ * Accesses to the view then return atomic proxies instead of references.
+ * @tparam View Source view.
+ */
+template <typename View>
+using make_unmanaged_atomic = make_unmanaged<View, Kokkos::Atomic>;
+
+/**
+ * Recreate a view with the unmanaged and random access memory traits, and
+ * with constant data.
+ * Accesses to the view then return constant references, which can be loaded
+ * through read-only caches on GPU.
+ * This should be updated to follow any update in Kokkos view structures.
+ * @tparam View Source view.
+ */
+template <typename View>
+using make_unmanaged_readonly = Kokkos::View<
+    typename View::traits::const_data_type,
+    typename View::traits::array_layout, typename View::traits::device_type,
+    typename View::traits::hooks_policy,
+    make_unmanaged_memory_traits<View, Kokkos::RandomAccess>>;
+
+/**
+ * Recreate a view with the unmanaged and restrict memory traits.
+ * Accesses to the view then return references qualified as not aliased by
+ * any other view.
+ * @tparam View Source view.
+ */
+template <typename View>
+using make_unmanaged_restrict = make_unmanaged<View, Kokkos::Restrict>;
+
+/**
+ * Check at compile time if a dimension of a view has a unit stride.
+ * @tparam View Source view.
+ * @tparam dimension Dimension to check.
+ */
+template <typename View, std::size_t dimension>
+inline constexpr bool has_unit_stride =
+    (std::is_same_v<typename View::traits::array_layout,
+                    Kokkos::LayoutRight> &&
+     dimension == View::rank() - 1) ||
+    (std::is_same_v<typename View::traits::array_layout, Kokkos::LayoutLeft> &&
+     dimension == 0);
+
+/**
+ * Add static extents to a data type.
+ * @tparam DataType Source data type.
+ * @tparam staticExtents Static extents to add, from left to right.
+ */
+template <typename DataType, std::size_t... staticExtents> struct add_extents {
+  using type = DataType;
+};
+
+template <typename DataType, std::size_t staticExtent,
+          std::size_t... staticExtents>
+struct add_extents<DataType, staticExtent, staticExtents...> {
+  using type =
+      typename add_extents<DataType, staticExtents...>::type[staticExtent];
+};
+
+/**
+ * Add dynamic extents to a data type.
+ * @tparam DataType Source data type.
+ * @tparam rankDynamic Number of dynamic extents to add.
+ */
+template <typename DataType, std::size_t rankDynamic> struct add_pointers {
+  using type = typename add_pointers<DataType, rankDynamic - 1>::type *;
+};
+
+template <typename DataType> struct add_pointers<DataType, 0> {
+  using type = DataType;
+};
+
+/**
+ * Recreate a view with the unmanaged memory trait and with the right-most
+ * extents known at compile time.
+ * This should be updated to follow any update in Kokkos view structures.
+ * @tparam View Source view.
+ * @tparam staticExtents Right-most static extents.
+ */
+template <typename View, std::size_t... staticExtents>
+using make_unmanaged_static_extents = Kokkos::View<
+    typename add_pointers<
+        typename add_extents<typename View::traits::value_type,
+                             staticExtents...>::type,
+        View::rank() - sizeof...(staticExtents)>::type,
+    typename View::traits::array_layout, typename View::traits::device_type,
+    typename View::traits::hooks_policy, make_unmanaged_memory_traits<View>>;
+
+/**
+ * Create an unmanaged view with the right-most extents known at compile time
+ * from a view and an index sequence.
+ * @tparam staticExtents Right-most static extents.
+ * @tparam View Source view (automatically deduced).
+ * @tparam indexSequence Index sequence (automatically deduced).
+ * @param data Input view.
+ * @param indexSequenceArg Index sequence of the dynamic extents of the view.
+ * @return Unmanaged view with static extents.
+ */
+template <std::size_t... staticExtents, typename View,
+          std::size_t... indexSequence>
+make_unmanaged_static_extents<View, staticExtents...>
+create_unmanaged_static_extents(
+    View const data,
+    [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg) {
+  return make_unmanaged_static_extents<View, staticExtents...>(
+      data.data(), data.extent(indexSequence)...);
+}
+
+/**
+ * Create an unmanaged view with the right-most extents known at compile time.
+ * The strides of the static dimensions are then folded at compile time when
+ * accessing the view.
+ * @tparam staticExtents Right-most static extents.
+ * @tparam View Source view (automatically deduced).
+ * @param data Input view. It must be contiguous, and have a right or left
+ * layout.
+ * @return Unmanaged view with static extents, sharing the data of the input
+ * view.
+ */
+template <std::size_t... staticExtents, typename View>
+make_unmanaged_static_extents<View, staticExtents...>
+create_unmanaged_static_extents(View const data) {
+  static_assert(sizeof...(staticExtents) <= View::rank(),
+                "Too many static extents");
+  static_assert(
+      std::is_same_v<typename View::traits::array_layout,
+                     Kokkos::LayoutRight> ||
+          std::is_same_v<typename View::traits::array_layout,
+                         Kokkos::LayoutLeft>,
+      "Static extents can only be used with a right or left layout");
+
+  std::size_t constexpr rankDynamic = View::rank() - sizeof...(staticExtents);
+
+  // check the static extents match the ones of the view
+  std::size_t rank = rankDynamic;
+  if (!((data.extent(rank++) == staticExtents) && ...)) {
+    Kokkos::abort("Static extent does not match the extent of the view");
+  }
+
+  // the view is reinterpreted from its pointer, so it must not be padded
+  if (!data.span_is_contiguous()) {
+    Kokkos::abort("Static extents can only be used with a contiguous view");
+  }
+
+  return create_unmanaged_static_extents<staticExtents...>(
+      data, std::make_index_sequence<rankDynamic>());
+}
+
+/**
+ * Layout with the dimensions in reverse order.
+ * A right layout becomes a left one and conversely, a strided layout remains
+ * strided.
+ * @tparam Layout Source layout.
+ */
+template <typename Layout> struct reverse_layout {
+  using type = Layout;
+};
+
+template <> struct reverse_layout<Kokkos::LayoutRight> {
+  using type = Kokkos::LayoutLeft;
+};
+
+template <> struct reverse_layout<Kokkos::LayoutLeft> {
+  using type = Kokkos::LayoutRight;
+};
+
+/**
+ * Recreate a view with the unmanaged memory trait and with its dimensions in
+ * reverse order.
+ * This should be updated to follow any update in Kokkos view structures.
+ * @tparam View Source view.
+ */
+template <typename View>
+using make_unmanaged_reversed = Kokkos::View<
+    typename View::traits::data_type,
+    typename reverse_layout<typename View::traits::array_layout>::type,
+    typename View::traits::device_type, typename View::traits::hooks_policy,
+    make_unmanaged_memory_traits<View>>;
+
+/**
+ * Create an unmanaged view with its dimensions in reverse order from a view
+ * and an index sequence.
+ * @tparam View Source view (automatically deduced).
+ * @tparam indexSequence Index sequence (automatically deduced).
+ * @param data Input view.
+ * @param indexSequenceArg Index sequence of the dimensions of the view.
+ * @return Unmanaged view with reversed dimensions.
+ */
+template <typename View, std::size_t... indexSequence>
+make_unmanaged_reversed<View> create_unmanaged_reversed(
+    View const data,
+    [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg) {
+  std::size_t constexpr rank = View::rank();
+
+  if constexpr (std::is_same_v<typename View::traits::array_layout,
+                               Kokkos::LayoutStride>) {
+    Kokkos::LayoutStride layout;
+    ((layout.dimension[indexSequence] = data.extent(rank - 1 - indexSequence),
+      layout.stride[indexSequence] = data.stride(rank - 1 - indexSequence)),
+     ...);
+
+    return make_unmanaged_reversed<View>(data.data(), layout);
+  } else {
+    return make_unmanaged_reversed<View>(
+        data.data(), data.extent(rank - 1 - indexSequence)...);
+  }
+}
+
+/**
+ * Create an unmanaged view with its dimensions in reverse order.
+ * The right-most dimension of the new view is the left-most one of the input
+ * view, so that a left layout view is walked contiguously by loops with the
+ * right-most index innermost.
+ * @tparam View Source view (automatically deduced).
+ * @param data Input view. It must not have static extents, and must be
+ * contiguous if it has a right or left layout.
+ * @return Unmanaged view with reversed dimensions, sharing the data of the
+ * input view.
+ */
+template <typename View>
+make_unmanaged_reversed<View> create_unmanaged_reversed(View const data) {
+  static_assert(View::rank_dynamic() == View::rank(),
+                "Dimensions can only be reversed without static extents");
+
+  // the view is reinterpreted from its pointer, so it must not be padded
+  if constexpr (!std::is_same_v<typename View::traits::array_layout,
+                                Kokkos::LayoutStride>) {
+    if (!data.span_is_contiguous()) {
+      Kokkos::abort("Dimensions can only be reversed with a contiguous view");
+    }
+  }
+
+  return create_unmanaged_reversed(data,
+                                   std::make_index_sequence<View::rank()>());
+}
+
+/**
+ * Type of a subview with its left-most dimensions fixed, from index
+ * sequences.
+ * @tparam View Source view.
+ * @tparam IndexSequence Index sequence of the fixed dimensions.
+ * @tparam AllSequence Index sequence of the kept dimensions.
+ */
+template <typename View, typename IndexSequence, typename AllSequence>
+struct subview_left_sequences;
+
+template <typename View, std::size_t... indexSequence,
+          std::size_t... allSequence>
+struct subview_left_sequences<View, std::index_sequence<indexSequence...>,
+                              std::index_sequence<allSequence...>> {
+  using type = decltype(Kokkos::subview(
+      std::declval<View const &>(),
+      (static_cast<void>(indexSequence), std::size_t())...,
+      (static_cast<void>(allSequence), Kokkos::ALL)...));
+};
+
+/**
+ * Type of a subview with its left-most dimensions fixed.
+ * If no dimension is fixed, this is the source view.
+ * @tparam View Source view.
+ * @tparam fixed Number of left-most dimensions fixed by an index.
+ */
+template <typename View, std::size_t fixed> struct subview_left {
+  using type = typename subview_left_sequences<
+      View, std::make_index_sequence<fixed>,
+      std::make_index_sequence<View::rank() - fixed>>::type;
+};
+
+template <typename View> struct subview_left<View, 0> {
+  using type = View;
+};
+
+/**
+ * Extents of the tiles of a tiled view, known at compile time.
+ * If no extent is given, the view is not tiled.
+ * @tparam tileExtents Extents of a tile, from left to right.
+ */
+template <std::size_t... tileExtents> struct tile_extents {
+  /**
+   * Number of tiled dimensions.
+   */
+  static std::size_t constexpr rank = sizeof...(tileExtents);
+
+  /**
+   * Get the extent of a tile in a dimension.
+   * @param dimension Dimension, starting from 0 for the left-most one.
+   * @return Extent of a tile.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr extent(std::size_t const dimension) {
+    std::size_t const extents[] = {tileExtents..., 0};
+
+    return extents[dimension];
+  }
+};
+
+/**
+ * Recreate a view as a tiled view.
+ * The tiled view has twice the rank of the source view: its left-most
+ * dimensions index the tiles, and its right-most dimensions, known at compile
+ * time, index the elements in a tile. With a right layout, each tile is then
+ * contiguous, and the tiles are stored from right to left.
+ * This should be updated to follow any update in Kokkos view structures.
+ * @tparam View Source view, without static extents.
+ * @tparam tileExtents Extents of a tile, from left to right.
+ */
+template <typename View, std::size_t... tileExtents>
+using make_tiled = Kokkos::View<
+    typename add_pointers<
+        typename add_extents<typename View::traits::value_type,
+                             tileExtents...>::type,
+        View::rank()>::type,
+    Kokkos::LayoutRight, typename View::traits::device_type,
+    typename View::traits::hooks_policy,
+    typename View::traits::memory_traits>;
 
 } // namespace kokkos_addendum
 
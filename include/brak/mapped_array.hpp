@@ -0,0 +1,295 @@
+#ifndef __BRAK_MAPPED_ARRAY_HPP__
+#define __BRAK_MAPPED_ARRAY_HPP__
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/kokkos_view.hpp"
+#include "brak/wrapper_array.hpp"
+
+namespace brak {
+
+/**
+ * Expected access pattern of a mapped file, given as a hint to the system.
+ */
+enum class MappedAccess {
+  /**
+   * No particular pattern.
+   */
+  normal,
+
+  /**
+   * Sequential accesses, pages are read ahead aggressively and released
+   * after being read.
+   */
+  sequential,
+
+  /**
+   * Random accesses, pages are not read ahead.
+   */
+  random,
+};
+
+/**
+ * Tag of mapped arrays whose modifications are written back to the file.
+ */
+struct WriteBack {};
+
+/**
+ * Tag of mapped arrays whose modifications are written back to the file, to
+ * be given to the constructor of `brak::MappedArray`.
+ */
+inline constexpr WriteBack write_back{};
+
+/**
+ * Array mapped from a raw binary file, as dumped from a C array.
+ * The file is mapped in memory with `mmap`, and the mapping is wrapped as an
+ * unmanaged view in host space. Creating the array does not read the file:
+ * pages are read on demand when they are first accessed.
+ * If the type of the elements is constant, the file is mapped read-only;
+ * otherwise, modifications are private to the process (copy-on-write) and
+ * the file is left untouched, unless the array is constructed with
+ * `brak::write_back`.
+ * This class is only available on POSIX systems.
+ * @tparam T Type of the elements, possibly constant.
+ * @tparam rank Rank of the array.
+ * @tparam Layout Layout of the data in the file. A C array has a right
+ * layout, a Fortran array a left layout.
+ */
+template <typename T, std::size_t rank, typename Layout = Kokkos::LayoutRight>
+class MappedArray {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Mapped elements must be trivially copyable");
+  static_assert(rank > 0, "Mapped arrays must have a rank of at least 1");
+
+public:
+  /**
+   * Type of the unmanaged view of the mapping.
+   */
+  using View = Kokkos::View<
+      typename kokkos_addendum::add_pointers<T, rank>::type, Layout,
+      Kokkos::HostSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+private:
+  /**
+   * Unmanaged view of the mapping.
+   */
+  View mData;
+
+  /**
+   * Address of the mapping, or null if there is no mapping.
+   */
+  void *mMapping = nullptr;
+
+  /**
+   * Size of the mapping in bytes.
+   */
+  std::size_t mBytes = 0;
+
+public:
+  /**
+   * Map a file, without modifying it.
+   * @tparam ExtentsType Type of the extents.
+   * @param path Path to the file. It only needs to be readable.
+   * @param extents Pack of extents of the array. The number of extents must
+   * match the rank. The file must be at least as large as the array.
+   */
+  template <typename... ExtentsType>
+  explicit MappedArray(std::string const &path,
+                       ExtentsType const... extents) {
+    map(false, path, extents...);
+  }
+
+  /**
+   * Map a file, and write the modifications of the elements back to it.
+   * @tparam ExtentsType Type of the extents.
+   * @param tag Write-back tag, `brak::write_back`.
+   * @param path Path to the file. It must be readable and writable.
+   * @param extents Pack of extents of the array. The number of extents must
+   * match the rank. The file must be at least as large as the array.
+   */
+  template <typename... ExtentsType>
+  MappedArray([[maybe_unused]] WriteBack const tag, std::string const &path,
+              ExtentsType const... extents) {
+    static_assert(!std::is_const_v<T>,
+                  "Constant elements cannot be written back to the file");
+
+    map(true, path, extents...);
+  }
+
+  /**
+   * Unmap the file.
+   */
+  ~MappedArray() {
+    if (mMapping != nullptr) {
+      munmap(mMapping, mBytes);
+    }
+  }
+
+  MappedArray(MappedArray const &) = delete;
+  MappedArray &operator=(MappedArray const &) = delete;
+
+  /**
+   * Move a mapping.
+   * @param other Mapped array to move, which does not map anymore.
+   */
+  MappedArray(MappedArray &&other) noexcept
+      : mData(std::move(other.mData)),
+        mMapping(std::exchange(other.mMapping, nullptr)),
+        mBytes(std::exchange(other.mBytes, 0)) {}
+
+  /**
+   * Move a mapping, and unmap the current one.
+   * @param other Mapped array to move, which does not map anymore.
+   * @return Current mapped array.
+   */
+  MappedArray &operator=(MappedArray &&other) noexcept {
+    if (this != &other) {
+      if (mMapping != nullptr) {
+        munmap(mMapping, mBytes);
+      }
+      mData = std::move(other.mData);
+      mMapping = std::exchange(other.mMapping, nullptr);
+      mBytes = std::exchange(other.mBytes, 0);
+    }
+
+    return *this;
+  }
+
+  /**
+   * Give the expected access pattern of the array to the system, which
+   * adapts how it reads the pages of the file.
+   * @param access Expected access pattern.
+   */
+  void advise(MappedAccess const access) const {
+    if (mMapping == nullptr) {
+      return;
+    }
+
+    int advice = MADV_NORMAL;
+    if (access == MappedAccess::sequential) {
+      advice = MADV_SEQUENTIAL;
+    } else if (access == MappedAccess::random) {
+      advice = MADV_RANDOM;
+    }
+
+    // NOTE A failing advice is not an error, as it is only a hint.
+    madvise(mMapping, mBytes, advice);
+  }
+
+  /**
+   * Get the rank of the array.
+   * @return Rank of the array.
+   */
+  static std::size_t constexpr getRank() { return rank; }
+
+  /**
+   * Get the extent of a dimension of the array.
+   * @param dimension Dimension of the array, starting from 0 for the left-most
+   * one.
+   * @return Extent of the dimension.
+   */
+  std::size_t getExtent(std::size_t const dimension) const {
+    return mData.extent(dimension);
+  }
+
+  /**
+   * Retrieve the unmanaged view of the mapping.
+   * @return Unmanaged view.
+   * @note The view must not be used once the array is destroyed.
+   */
+  View getView() const { return mData; }
+
+  /**
+   * Get an array wrapper of the mapping, to be used in kernels on host.
+   * @return Array wrapper of the unmanaged view.
+   * @note The wrapper must not be used once the array is destroyed.
+   */
+  WrapperArray<View> getWrapper() const { return WrapperArray<View>(mData); }
+
+  /**
+   * Create a sub-wrapper with a rank lowered by 1.
+   * @param index Left-most index to extract from the array.
+   * @return A sub-wrapper or a reference to a scalar if the array has a rank
+   * of 1.
+   */
+  decltype(auto) operator[](std::size_t const index) const {
+    return getWrapper()[index];
+  }
+
+  /**
+   * Directly access to a scalar value.
+   * @tparam IndicesType Type of the indices.
+   * @param indices Pack of indices. The number of indices must match the
+   * rank.
+   * @return Reference to a scalar of the array at the given indices.
+   */
+  template <typename... IndicesType>
+  decltype(auto) operator()(IndicesType const... indices) const {
+    static_assert(sizeof...(indices) == rank, "Rank mismatch");
+
+    return mData(indices...);
+  }
+
+private:
+  /**
+   * Map a file.
+   * @tparam ExtentsType Type of the extents.
+   * @param isWriteBack If the modifications are written back to the file.
+   * @param path Path to the file.
+   * @param extents Pack of extents of the array.
+   */
+  template <typename... ExtentsType>
+  void map(bool const isWriteBack, std::string const &path,
+           ExtentsType const... extents) {
+    static_assert(sizeof...(extents) == rank, "Rank mismatch");
+
+    mBytes = (sizeof(T) * ... * static_cast<std::size_t>(extents));
+
+    int const file = open(path.c_str(), isWriteBack ? O_RDWR : O_RDONLY);
+    if (file == -1) {
+      Kokkos::abort(("Cannot open the file to map: " + path).c_str());
+    }
+
+    struct stat status;
+    if (fstat(file, &status) == -1 ||
+        static_cast<std::size_t>(status.st_size) < mBytes) {
+      close(file);
+      Kokkos::abort(("File too small for the mapped array: " + path).c_str());
+    }
+
+    // NOTE A mapping of size 0 is invalid, an empty array is not mapped.
+    if (mBytes > 0) {
+      // NOTE A private mapping can be written even if the file is opened
+      // read-only, the written pages being copied.
+      void *const mapping =
+          mmap(nullptr, mBytes,
+               std::is_const_v<T> ? PROT_READ : PROT_READ | PROT_WRITE,
+               isWriteBack ? MAP_SHARED : MAP_PRIVATE, file, 0);
+      if (mapping == MAP_FAILED) {
+        close(file);
+        Kokkos::abort(("Cannot map the file: " + path).c_str());
+      }
+      mMapping = mapping;
+    }
+
+    // the mapping remains valid once the file is closed
+    close(file);
+
+    mData = View(static_cast<T *>(mMapping),
+                 static_cast<std::size_t>(extents)...);
+  }
+};
+
+} // namespace brak
+
+#endif // ifndef __BRAK_MAPPED_ARRAY_HPP__
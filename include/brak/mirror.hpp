@@ -0,0 +1,198 @@
+#ifndef __BRAK_MIRROR_HPP__
+#define __BRAK_MIRROR_HPP__
+
+#include <cstddef>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_offset.hpp"
+#include "brak/wrapper_subview.hpp"
+
+namespace brak {
+
+/**
+ * Check if a type is a subview wrapper, at any depth.
+ * @tparam Type Type to check.
+ */
+template <typename Type> struct is_wrapper_subview : std::false_type {};
+
+template <typename View, std::size_t depth>
+struct is_wrapper_subview<WrapperSubview<View, depth>> : std::true_type {};
+
+/**
+ * Get the view to copy from or to of a wrapper or a view.
+ * @tparam ViewOrWrapper Type of the wrapper or the view (automatically
+ * deduced).
+ * @param object Wrapper or view. A wrapper must be a top-level wrapper, or a
+ * subview wrapper at any depth.
+ * @return View itself, wrapped view of a top-level wrapper, or subview of a
+ * subview wrapper.
+ */
+template <typename ViewOrWrapper>
+auto get_copy_view(ViewOrWrapper const &object) {
+  if constexpr (Kokkos::is_view<ViewOrWrapper>::value) {
+    return object;
+  } else {
+    // NOTE Only the subview wrapper can retrieve the view of a sub-wrapper,
+    // the other wrappers give the whole wrapped view.
+    static_assert(is_wrapper_subview<ViewOrWrapper>::value ||
+                      ViewOrWrapper::getRank() ==
+                          ViewOrWrapper::getRankSource(),
+                  "Copies can only be done from or to a top-level wrapper or "
+                  "a subview wrapper");
+
+    return object.getView();
+  }
+}
+
+/**
+ * Create a top-level array wrapper of another view, with the same index type
+ * and tiles as an array wrapper.
+ * @tparam ViewOther Type of the other view (automatically deduced).
+ * @tparam View Type of the view of the wrapper (automatically deduced).
+ * @tparam depth Depth of the wrapper (automatically deduced).
+ * @tparam IndexType Type of the indices (automatically deduced).
+ * @tparam Tiles Extents of the tiles (automatically deduced).
+ * @param wrapper Array wrapper, at any depth.
+ * @param data Other view.
+ * @return Array wrapper of the other view.
+ */
+template <typename ViewOther, typename View, std::size_t depth,
+          typename IndexType, typename Tiles>
+WrapperArray<ViewOther, 0, IndexType, Tiles> rewrap(
+    [[maybe_unused]] WrapperArray<View, depth, IndexType, Tiles> const &wrapper,
+    ViewOther const data) {
+  return WrapperArray<ViewOther, 0, IndexType, Tiles>(data);
+}
+
+/**
+ * Create a top-level offset wrapper of another view.
+ * @tparam ViewOther Type of the other view (automatically deduced).
+ * @tparam View Type of the view of the wrapper (automatically deduced).
+ * @tparam depth Depth of the wrapper (automatically deduced).
+ * @param wrapper Offset wrapper, at any depth.
+ * @param data Other view.
+ * @return Offset wrapper of the other view.
+ */
+template <typename ViewOther, typename View, std::size_t depth>
+WrapperOffset<ViewOther>
+rewrap([[maybe_unused]] WrapperOffset<View, depth> const &wrapper,
+       ViewOther const data) {
+  return WrapperOffset<ViewOther>(data);
+}
+
+/**
+ * Create a top-level subview wrapper of another view.
+ * @tparam ViewOther Type of the other view (automatically deduced).
+ * @tparam View Type of the view of the wrapper (automatically deduced).
+ * @tparam depth Depth of the wrapper (automatically deduced).
+ * @param wrapper Subview wrapper, at any depth.
+ * @param data Other view.
+ * @return Subview wrapper of the other view.
+ */
+template <typename ViewOther, typename View, std::size_t depth>
+WrapperSubview<ViewOther>
+rewrap([[maybe_unused]] WrapperSubview<View, depth> const &wrapper,
+       ViewOther const data) {
+  return WrapperSubview<ViewOther>(data);
+}
+
+/**
+ * Create a mirror of a wrapper on host.
+ * The mirror is always a new allocation, as with `Kokkos::create_mirror`.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to mirror. It must be a top-level wrapper, or a
+ * subview wrapper at any depth.
+ * @return Top-level wrapper of the mirror, of the same kind as the input
+ * wrapper. The data are not copied.
+ */
+template <typename Wrapper,
+          std::enable_if_t<!Kokkos::is_view<Wrapper>::value, int> = 0>
+auto create_mirror(Wrapper const &wrapper) {
+  return rewrap(wrapper, Kokkos::create_mirror(get_copy_view(wrapper)));
+}
+
+/**
+ * Create a mirror of a wrapper in a given memory space.
+ * @tparam Space Type of the space or of the allocation properties
+ * (automatically deduced).
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param space Memory space of the mirror, or any allocation properties
+ * accepted by `Kokkos::create_mirror`.
+ * @param wrapper Wrapper to mirror. It must be a top-level wrapper, or a
+ * subview wrapper at any depth.
+ * @return Top-level wrapper of the mirror, of the same kind as the input
+ * wrapper. The data are not copied.
+ */
+template <typename Space, typename Wrapper,
+          std::enable_if_t<!Kokkos::is_view<Wrapper>::value, int> = 0>
+auto create_mirror(Space const &space, Wrapper const &wrapper) {
+  return rewrap(wrapper,
+                Kokkos::create_mirror(space, get_copy_view(wrapper)));
+}
+
+/**
+ * Create a mirror view of a wrapper on host.
+ * As with `Kokkos::create_mirror_view`, the wrapped view is reused if it is
+ * already accessible from host.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to mirror. It must be a top-level wrapper, or a
+ * subview wrapper at any depth.
+ * @return Top-level wrapper of the mirror view, of the same kind as the input
+ * wrapper. The data are not copied.
+ */
+template <typename Wrapper,
+          std::enable_if_t<!Kokkos::is_view<Wrapper>::value, int> = 0>
+auto create_mirror_view(Wrapper const &wrapper) {
+  return rewrap(wrapper, Kokkos::create_mirror_view(get_copy_view(wrapper)));
+}
+
+/**
+ * Create a mirror view of a wrapper in a given memory space.
+ * @tparam Space Type of the space or of the allocation properties
+ * (automatically deduced).
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param space Memory space of the mirror view, or any allocation properties
+ * accepted by `Kokkos::create_mirror_view`.
+ * @param wrapper Wrapper to mirror. It must be a top-level wrapper, or a
+ * subview wrapper at any depth.
+ * @return Top-level wrapper of the mirror view, of the same kind as the input
+ * wrapper. The data are not copied.
+ */
+template <typename Space, typename Wrapper,
+          std::enable_if_t<!Kokkos::is_view<Wrapper>::value, int> = 0>
+auto create_mirror_view(Space const &space, Wrapper const &wrapper) {
+  return rewrap(wrapper,
+                Kokkos::create_mirror_view(space, get_copy_view(wrapper)));
+}
+
+/**
+ * Copy the data of a wrapper or a view into another one, on an instance of
+ * an execution space.
+ * The copy is enqueued on the instance, and is not awaited: the instance must
+ * be fenced before the destination is used out of the instance. Copies and
+ * kernels on different instances can then overlap.
+ * @tparam ExecutionSpace Type of the execution space (automatically deduced).
+ * @tparam Destination Type of the destination wrapper or view (automatically
+ * deduced).
+ * @tparam Source Type of the source wrapper or view (automatically deduced).
+ * @param exec Instance of the execution space to copy on.
+ * @param destination Wrapper or view to copy into. A wrapper must be a
+ * top-level wrapper, or a subview wrapper at any depth.
+ * @param source Wrapper or view to copy from. A wrapper must be a top-level
+ * wrapper, or a subview wrapper at any depth.
+ */
+template <typename ExecutionSpace, typename Destination, typename Source>
+void deep_copy_async(ExecutionSpace const &exec,
+                     Destination const &destination, Source const &source) {
+  static_assert(Kokkos::is_execution_space<ExecutionSpace>::value,
+                "Copies must be done on an instance of an execution space");
+
+  Kokkos::deep_copy(exec, get_copy_view(destination), get_copy_view(source));
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_MIRROR_HPP__
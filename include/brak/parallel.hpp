@@ -0,0 +1,550 @@
+#ifndef __BRAK_PARALLEL_HPP__
+#define __BRAK_PARALLEL_HPP__
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+namespace brak {
+
+/**
+ * Iteration pattern following the layout of the view of a wrapper, so that
+ * the innermost iterations run along the contiguous dimension.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Wrapper>
+inline constexpr Kokkos::Iterate nest_iterate =
+    std::is_same_v<typename decltype(std::declval<Wrapper>()
+                                         .getView())::traits::array_layout,
+                   Kokkos::LayoutLeft>
+        ? Kokkos::Iterate::Left
+        : Kokkos::Iterate::Right;
+
+/**
+ * Bounds of a loop nest over a wrapper.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Wrapper>
+using nest_bounds = Kokkos::Array<std::int64_t, Wrapper::getRank()>;
+
+/**
+ * Create the execution policy of a loop nest over a wrapper.
+ * For a rank of 1, this is a range policy. Otherwise, this is a
+ * multi-dimensional range policy, whose iteration pattern follows the layout
+ * of the view. On host, tiles span the whole contiguous dimension.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to iterate over. Its view defines the execution
+ * space.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @return Execution policy.
+ */
+template <typename Wrapper>
+auto make_nest_policy([[maybe_unused]] Wrapper const &wrapper,
+                      nest_bounds<Wrapper> const &lower,
+                      nest_bounds<Wrapper> const &upper) {
+  using ExecutionSpace =
+      typename decltype(wrapper.getView())::traits::execution_space;
+  std::size_t constexpr rank = Wrapper::getRank();
+
+  static_assert(rank <= 6, "Multi-dimensional range policies are limited to "
+                           "6 dimensions");
+
+  if constexpr (rank == 1) {
+    return Kokkos::RangePolicy<ExecutionSpace,
+                               Kokkos::IndexType<std::int64_t>>(lower[0],
+                                                                upper[0]);
+  } else {
+    Kokkos::Iterate constexpr iterate = nest_iterate<Wrapper>;
+    using Policy =
+        Kokkos::MDRangePolicy<ExecutionSpace,
+                              Kokkos::Rank<rank, iterate, iterate>,
+                              Kokkos::IndexType<std::int64_t>>;
+
+    if constexpr (Kokkos::SpaceAccessibility<ExecutionSpace,
+                                             Kokkos::HostSpace>::accessible) {
+      // on host, a tile spans the whole contiguous dimension
+      std::size_t const contiguous =
+          iterate == Kokkos::Iterate::Left ? 0 : rank - 1;
+      typename Policy::tile_type tiles;
+      for (std::size_t dimension = 0; dimension < rank; dimension++) {
+        tiles[dimension] =
+            dimension == contiguous && upper[dimension] > lower[dimension]
+                ? upper[dimension] - lower[dimension]
+                : 1;
+      }
+
+      return Policy(lower, upper, tiles);
+    } else {
+      // on device, let Kokkos choose the tiles
+      return Policy(lower, upper);
+    }
+  }
+}
+
+/**
+ * Create the execution policy of a loop nest over the whole extents of a
+ * wrapper.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to iterate over.
+ * @return Execution policy.
+ */
+template <typename Wrapper> auto make_nest_policy(Wrapper const &wrapper) {
+  nest_bounds<Wrapper> lower;
+  nest_bounds<Wrapper> upper;
+  for (std::size_t dimension = 0; dimension < Wrapper::getRank();
+       dimension++) {
+    lower[dimension] = 0;
+    upper[dimension] = wrapper.getExtent(dimension);
+  }
+
+  return make_nest_policy(wrapper, lower, upper);
+}
+
+/**
+ * Run a loop nest over a wrapper in parallel.
+ * This replaces a legacy nest of `for` loops, whose body is given as a
+ * functor that receives the indices in the same order as the loops.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @tparam Functor Type of the functor (automatically deduced).
+ * @param label Label of the kernel.
+ * @param wrapper Wrapper to iterate over.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @param functor Body of the loop nest.
+ */
+template <typename Wrapper, typename Functor>
+void parallel_nest(std::string const &label, Wrapper const &wrapper,
+                   nest_bounds<Wrapper> const &lower,
+                   nest_bounds<Wrapper> const &upper, Functor const &functor) {
+  Kokkos::parallel_for(label, make_nest_policy(wrapper, lower, upper),
+                       functor);
+}
+
+/**
+ * Run a loop nest over a wrapper in parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @tparam Functor Type of the functor (automatically deduced).
+ * @param wrapper Wrapper to iterate over.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @param functor Body of the loop nest.
+ */
+template <typename Wrapper, typename Functor>
+void parallel_nest(Wrapper const &wrapper, nest_bounds<Wrapper> const &lower,
+                   nest_bounds<Wrapper> const &upper, Functor const &functor) {
+  parallel_nest("brak::parallel_nest", wrapper, lower, upper, functor);
+}
+
+/**
+ * Run a loop nest over the whole extents of a wrapper in parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @tparam Functor Type of the functor (automatically deduced).
+ * @param label Label of the kernel.
+ * @param wrapper Wrapper to iterate over.
+ * @param functor Body of the loop nest.
+ */
+template <typename Wrapper, typename Functor>
+void parallel_nest(std::string const &label, Wrapper const &wrapper,
+                   Functor const &functor) {
+  Kokkos::parallel_for(label, make_nest_policy(wrapper), functor);
+}
+
+/**
+ * Run a loop nest over the whole extents of a wrapper in parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @tparam Functor Type of the functor (automatically deduced).
+ * @param wrapper Wrapper to iterate over.
+ * @param functor Body of the loop nest.
+ */
+template <typename Wrapper, typename Functor>
+void parallel_nest(Wrapper const &wrapper, Functor const &functor) {
+  parallel_nest("brak::parallel_nest", wrapper, functor);
+}
+
+/**
+ * Type of the elements of a wrapper.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Wrapper>
+using wrapper_value_t = std::remove_cv_t<
+    std::remove_pointer_t<decltype(*std::declval<Wrapper &>())>>;
+
+/**
+ * Type of an index of a loop nest.
+ * @tparam dimension Dimension of the index.
+ */
+template <std::size_t dimension> struct nest_index {
+  using type = std::int64_t;
+};
+
+/**
+ * Functor of a reduction over a loop nest, which joins a term computed at
+ * each iteration with a reducer.
+ * @tparam Term Type of the term functor, called with the indices.
+ * @tparam Reducer Type of the Kokkos reducer.
+ * @tparam IndexSequence Index sequence of the dimensions of the loop nest.
+ */
+template <typename Term, typename Reducer, typename IndexSequence>
+class NestReduceFunctor;
+
+template <typename Term, typename Reducer, std::size_t... indexSequence>
+class NestReduceFunctor<Term, Reducer, std::index_sequence<indexSequence...>> {
+  /**
+   * Term computed at each iteration.
+   */
+  Term mTerm;
+
+  /**
+   * Reducer joining the terms.
+   */
+  Reducer mReducer;
+
+public:
+  /**
+   * Construct the functor.
+   * @param term Term computed at each iteration.
+   * @param reducer Reducer joining the terms.
+   */
+  NestReduceFunctor(Term const &term, Reducer const &reducer)
+      : mTerm(term), mReducer(reducer) {}
+
+  /**
+   * Join the term of an iteration.
+   * @param indices Pack of indices of the iteration.
+   * @param value Value of the reduction.
+   */
+  KOKKOS_FUNCTION
+  void operator()(typename nest_index<indexSequence>::type const... indices,
+                  typename Reducer::value_type &value) const {
+    mReducer.join(value, mTerm(indices...));
+  }
+};
+
+/**
+ * Term of a reduction over one wrapper.
+ * @tparam Operation Type of the operation applied to the element.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Operation, typename Wrapper> class NestTransformTerm {
+  /**
+   * Operation applied to the element.
+   */
+  Operation mOperation;
+
+  /**
+   * Wrapper to reduce.
+   */
+  Wrapper mWrapper;
+
+public:
+  /**
+   * Construct the term.
+   * @param operation Operation applied to the element.
+   * @param wrapper Wrapper to reduce.
+   */
+  NestTransformTerm(Operation const &operation, Wrapper const &wrapper)
+      : mOperation(operation), mWrapper(wrapper) {}
+
+  /**
+   * Compute the term of an iteration.
+   * @tparam IndicesType Type of the indices.
+   * @param indices Pack of indices of the iteration.
+   * @return Operation applied to the element.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION auto operator()(IndicesType const... indices) const {
+    return mOperation(mWrapper(indices...));
+  }
+};
+
+/**
+ * Term of a reduction over two wrappers.
+ * @tparam Operation Type of the operation applied to the elements.
+ * @tparam Wrapper1 Type of the first wrapper.
+ * @tparam Wrapper2 Type of the second wrapper.
+ */
+template <typename Operation, typename Wrapper1, typename Wrapper2>
+class NestTransformTerm2 {
+  /**
+   * Operation applied to the elements.
+   */
+  Operation mOperation;
+
+  /**
+   * First wrapper to reduce.
+   */
+  Wrapper1 mWrapper1;
+
+  /**
+   * Second wrapper to reduce.
+   */
+  Wrapper2 mWrapper2;
+
+public:
+  /**
+   * Construct the term.
+   * @param operation Operation applied to the elements.
+   * @param wrapper1 First wrapper to reduce.
+   * @param wrapper2 Second wrapper to reduce.
+   */
+  NestTransformTerm2(Operation const &operation, Wrapper1 const &wrapper1,
+                     Wrapper2 const &wrapper2)
+      : mOperation(operation), mWrapper1(wrapper1), mWrapper2(wrapper2) {}
+
+  /**
+   * Compute the term of an iteration.
+   * @tparam IndicesType Type of the indices.
+   * @param indices Pack of indices of the iteration.
+   * @return Operation applied to the elements.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION auto operator()(IndicesType const... indices) const {
+    return mOperation(mWrapper1(indices...), mWrapper2(indices...));
+  }
+};
+
+/**
+ * Identity operation.
+ */
+struct NestIdentity {
+  /**
+   * Return the value unchanged.
+   * @tparam ValueType Type of the value.
+   * @param value Input value.
+   * @return Input value.
+   */
+  template <typename ValueType>
+  KOKKOS_FUNCTION ValueType operator()(ValueType const value) const {
+    return value;
+  }
+};
+
+/**
+ * Reduce a term over a loop nest in parallel.
+ * @tparam Wrapper Type of the wrapper defining the loop nest (automatically
+ * deduced).
+ * @tparam Term Type of the term functor (automatically deduced).
+ * @tparam Reducer Type of the Kokkos reducer (automatically deduced).
+ * @param label Label of the kernel.
+ * @param wrapper Wrapper defining the execution space and the rank of the
+ * loop nest.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @param term Term computed at each iteration.
+ * @param reducer Kokkos reducer, that stores the result.
+ */
+template <typename Wrapper, typename Term, typename Reducer>
+void parallel_nest_reduce(std::string const &label, Wrapper const &wrapper,
+                          nest_bounds<Wrapper> const &lower,
+                          nest_bounds<Wrapper> const &upper, Term const &term,
+                          Reducer const &reducer) {
+  Kokkos::parallel_reduce(
+      label, make_nest_policy(wrapper, lower, upper),
+      NestReduceFunctor<Term, Reducer,
+                        std::make_index_sequence<Wrapper::getRank()>>(
+          term, reducer),
+      reducer);
+}
+
+/**
+ * Get the whole extents of a wrapper as bounds of a loop nest.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to iterate over.
+ * @return Upper bounds of the loop nest, the lower bounds being 0.
+ */
+template <typename Wrapper>
+nest_bounds<Wrapper> get_nest_extents(Wrapper const &wrapper) {
+  nest_bounds<Wrapper> upper;
+  for (std::size_t dimension = 0; dimension < Wrapper::getRank();
+       dimension++) {
+    upper[dimension] = wrapper.getExtent(dimension);
+  }
+
+  return upper;
+}
+
+/**
+ * Reduce the transformed elements of a wrapper in parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @tparam Operation Type of the operation (automatically deduced).
+ * @tparam Reducer Type of the Kokkos reducer (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @param operation Operation applied to each element.
+ * @param reducer Kokkos reducer, that stores the result.
+ */
+template <typename Wrapper, typename Operation, typename Reducer>
+void transform_reduce(Wrapper const &wrapper, nest_bounds<Wrapper> const &lower,
+                      nest_bounds<Wrapper> const &upper,
+                      Operation const &operation, Reducer const &reducer) {
+  parallel_nest_reduce(
+      "brak::transform_reduce", wrapper, lower, upper,
+      NestTransformTerm<Operation, Wrapper>(operation, wrapper), reducer);
+}
+
+/**
+ * Reduce the transformed elements of a wrapper over its whole extents in
+ * parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @tparam Operation Type of the operation (automatically deduced).
+ * @tparam Reducer Type of the Kokkos reducer (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @param operation Operation applied to each element.
+ * @param reducer Kokkos reducer, that stores the result.
+ */
+template <typename Wrapper, typename Operation, typename Reducer>
+void transform_reduce(Wrapper const &wrapper, Operation const &operation,
+                      Reducer const &reducer) {
+  transform_reduce(wrapper, nest_bounds<Wrapper>{}, get_nest_extents(wrapper),
+                   operation, reducer);
+}
+
+/**
+ * Reduce the transformed elements of two wrappers in parallel.
+ * @tparam Wrapper1 Type of the first wrapper (automatically deduced).
+ * @tparam Wrapper2 Type of the second wrapper (automatically deduced).
+ * @tparam Operation Type of the operation (automatically deduced).
+ * @tparam Reducer Type of the Kokkos reducer (automatically deduced).
+ * @param wrapper1 First wrapper to reduce. It defines the execution space.
+ * @param wrapper2 Second wrapper to reduce. It must have the same rank.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @param operation Operation applied to each pair of elements.
+ * @param reducer Kokkos reducer, that stores the result.
+ */
+template <typename Wrapper1, typename Wrapper2, typename Operation,
+          typename Reducer>
+void transform_reduce(Wrapper1 const &wrapper1, Wrapper2 const &wrapper2,
+                      nest_bounds<Wrapper1> const &lower,
+                      nest_bounds<Wrapper1> const &upper,
+                      Operation const &operation, Reducer const &reducer) {
+  static_assert(Wrapper1::getRank() == Wrapper2::getRank(), "Rank mismatch");
+
+  parallel_nest_reduce(
+      "brak::transform_reduce", wrapper1, lower, upper,
+      NestTransformTerm2<Operation, Wrapper1, Wrapper2>(operation, wrapper1,
+                                                        wrapper2),
+      reducer);
+}
+
+/**
+ * Reduce the transformed elements of two wrappers over the whole extents of
+ * the first one in parallel.
+ * @tparam Wrapper1 Type of the first wrapper (automatically deduced).
+ * @tparam Wrapper2 Type of the second wrapper (automatically deduced).
+ * @tparam Operation Type of the operation (automatically deduced).
+ * @tparam Reducer Type of the Kokkos reducer (automatically deduced).
+ * @param wrapper1 First wrapper to reduce. It defines the execution space.
+ * @param wrapper2 Second wrapper to reduce. It must have the same rank.
+ * @param operation Operation applied to each pair of elements.
+ * @param reducer Kokkos reducer, that stores the result.
+ */
+template <typename Wrapper1, typename Wrapper2, typename Operation,
+          typename Reducer>
+void transform_reduce(Wrapper1 const &wrapper1, Wrapper2 const &wrapper2,
+                      Operation const &operation, Reducer const &reducer) {
+  transform_reduce(wrapper1, wrapper2, nest_bounds<Wrapper1>{},
+                   get_nest_extents(wrapper1), operation, reducer);
+}
+
+/**
+ * Compute the maximum of the elements of a wrapper in parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @return Maximum value.
+ */
+template <typename Wrapper>
+wrapper_value_t<Wrapper> reduce_max(Wrapper const &wrapper,
+                                    nest_bounds<Wrapper> const &lower,
+                                    nest_bounds<Wrapper> const &upper) {
+  wrapper_value_t<Wrapper> result;
+  transform_reduce(wrapper, lower, upper, NestIdentity(),
+                   Kokkos::Max<wrapper_value_t<Wrapper>>(result));
+
+  return result;
+}
+
+/**
+ * Compute the maximum of the elements of a wrapper over its whole extents in
+ * parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @return Maximum value.
+ */
+template <typename Wrapper>
+wrapper_value_t<Wrapper> reduce_max(Wrapper const &wrapper) {
+  return reduce_max(wrapper, nest_bounds<Wrapper>{}, get_nest_extents(wrapper));
+}
+
+/**
+ * Compute the minimum of the elements of a wrapper in parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @return Minimum value.
+ */
+template <typename Wrapper>
+wrapper_value_t<Wrapper> reduce_min(Wrapper const &wrapper,
+                                    nest_bounds<Wrapper> const &lower,
+                                    nest_bounds<Wrapper> const &upper) {
+  wrapper_value_t<Wrapper> result;
+  transform_reduce(wrapper, lower, upper, NestIdentity(),
+                   Kokkos::Min<wrapper_value_t<Wrapper>>(result));
+
+  return result;
+}
+
+/**
+ * Compute the minimum of the elements of a wrapper over its whole extents in
+ * parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @return Minimum value.
+ */
+template <typename Wrapper>
+wrapper_value_t<Wrapper> reduce_min(Wrapper const &wrapper) {
+  return reduce_min(wrapper, nest_bounds<Wrapper>{}, get_nest_extents(wrapper));
+}
+
+/**
+ * Compute the sum of the elements of a wrapper in parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @param lower Lower bounds of the loop nest (included).
+ * @param upper Upper bounds of the loop nest (excluded).
+ * @return Sum of the values.
+ */
+template <typename Wrapper>
+wrapper_value_t<Wrapper> reduce_sum(Wrapper const &wrapper,
+                                    nest_bounds<Wrapper> const &lower,
+                                    nest_bounds<Wrapper> const &upper) {
+  wrapper_value_t<Wrapper> result;
+  transform_reduce(wrapper, lower, upper, NestIdentity(),
+                   Kokkos::Sum<wrapper_value_t<Wrapper>>(result));
+
+  return result;
+}
+
+/**
+ * Compute the sum of the elements of a wrapper over its whole extents in
+ * parallel.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper to reduce.
+ * @return Sum of the values.
+ */
+template <typename Wrapper>
+wrapper_value_t<Wrapper> reduce_sum(Wrapper const &wrapper) {
+  return reduce_sum(wrapper, nest_bounds<Wrapper>{}, get_nest_extents(wrapper));
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_PARALLEL_HPP__
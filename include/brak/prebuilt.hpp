@@ -0,0 +1,154 @@
+#ifndef __BRAK_PREBUILT_HPP__
+#define __BRAK_PREBUILT_HPP__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/kokkos_view.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_offset.hpp"
+#include "brak/wrapper_subview.hpp"
+
+namespace brak::prebuilt {
+
+/**
+ * Type of the view of a sub-wrapper at a given depth.
+ * The view is made unmanaged at the first access.
+ * @tparam View Type of the view of the top-level wrapper.
+ * @tparam depth Depth of the sub-wrapper.
+ */
+template <typename View, std::size_t depth>
+using sub_view_t =
+    std::conditional_t<depth == 0 || View::traits::memory_traits::is_unmanaged,
+                       View, kokkos_addendum::make_unmanaged<View>>;
+
+} // namespace brak::prebuilt
+
+// NOTE The macros below list the explicit instantiations of the wrappers for
+// common views. A top-level view is spelled as in user code, and the views of
+// the sub-wrappers are the unmanaged views obtained from them. As these views
+// do not depend on how the top-level view is spelled, the whole chain of
+// sub-wrappers is listed for one spelling only.
+// The array wrapper is not listed, as no compilation time saved by its
+// explicit instantiations has been measured yet.
+
+/**
+ * List the instantiations of the sub-wrappers of a given depth of a view.
+ * @param EXTERN `extern` for declarations, nothing for definitions.
+ * @param depth Depth of the sub-wrappers.
+ * @param ... Type of the top-level view.
+ */
+#define BRAK_PREBUILT_DEPTH(EXTERN, depth, ...)                                \
+  EXTERN template class ::brak::WrapperOffset<                                 \
+      ::brak::prebuilt::sub_view_t<__VA_ARGS__, depth>, depth>;                \
+  EXTERN template class ::brak::WrapperSubview<                                \
+      ::brak::prebuilt::sub_view_t<__VA_ARGS__, depth>, depth>;
+
+#define BRAK_PREBUILT_CHAIN_1(EXTERN, ...)                                     \
+  BRAK_PREBUILT_DEPTH(EXTERN, 0, __VA_ARGS__)
+#define BRAK_PREBUILT_CHAIN_2(EXTERN, ...)                                     \
+  BRAK_PREBUILT_CHAIN_1(EXTERN, __VA_ARGS__)                                   \
+  BRAK_PREBUILT_DEPTH(EXTERN, 1, __VA_ARGS__)
+#define BRAK_PREBUILT_CHAIN_3(EXTERN, ...)                                     \
+  BRAK_PREBUILT_CHAIN_2(EXTERN, __VA_ARGS__)                                   \
+  BRAK_PREBUILT_DEPTH(EXTERN, 2, __VA_ARGS__)
+#define BRAK_PREBUILT_CHAIN_4(EXTERN, ...)                                     \
+  BRAK_PREBUILT_CHAIN_3(EXTERN, __VA_ARGS__)                                   \
+  BRAK_PREBUILT_DEPTH(EXTERN, 3, __VA_ARGS__)
+#define BRAK_PREBUILT_CHAIN_5(EXTERN, ...)                                     \
+  BRAK_PREBUILT_CHAIN_4(EXTERN, __VA_ARGS__)                                   \
+  BRAK_PREBUILT_DEPTH(EXTERN, 4, __VA_ARGS__)
+#define BRAK_PREBUILT_CHAIN_6(EXTERN, ...)                                     \
+  BRAK_PREBUILT_CHAIN_5(EXTERN, __VA_ARGS__)                                   \
+  BRAK_PREBUILT_DEPTH(EXTERN, 5, __VA_ARGS__)
+#define BRAK_PREBUILT_CHAIN_7(EXTERN, ...)                                     \
+  BRAK_PREBUILT_CHAIN_6(EXTERN, __VA_ARGS__)                                   \
+  BRAK_PREBUILT_DEPTH(EXTERN, 6, __VA_ARGS__)
+#define BRAK_PREBUILT_CHAIN_8(EXTERN, ...)                                     \
+  BRAK_PREBUILT_CHAIN_7(EXTERN, __VA_ARGS__)                                   \
+  BRAK_PREBUILT_DEPTH(EXTERN, 7, __VA_ARGS__)
+
+/**
+ * List the instantiations of the top-level wrappers only of a view.
+ * @param EXTERN `extern` for declarations, nothing for definitions.
+ * @param ... Type of the top-level view.
+ */
+#define BRAK_PREBUILT_TOP(EXTERN, ...)                                         \
+  BRAK_PREBUILT_DEPTH(EXTERN, 0, __VA_ARGS__)
+
+// views in host space, only when the default memory space is not on host
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) ||               \
+    defined(KOKKOS_ENABLE_SYCL) || defined(KOKKOS_ENABLE_OPENMPTARGET) ||      \
+    defined(KOKKOS_ENABLE_OPENACC)
+#define BRAK_PREBUILT_HOST(EXTERN, rank, ValueType, pointers)                  \
+  BRAK_PREBUILT_CHAIN_##rank(                                                  \
+      EXTERN, Kokkos::View<ValueType pointers, Kokkos::HostSpace>)             \
+  BRAK_PREBUILT_CHAIN_##rank(EXTERN,                                           \
+                             Kokkos::View<ValueType pointers,                  \
+                                          Kokkos::LayoutLeft,                  \
+                                          Kokkos::HostSpace>)
+#else
+#define BRAK_PREBUILT_HOST(EXTERN, rank, ValueType, pointers)
+#endif
+
+/**
+ * List the instantiations of the wrappers of views of a value type and a
+ * rank, with a right and a left layout.
+ * @param EXTERN `extern` for declarations, nothing for definitions.
+ * @param rank Rank of the views.
+ * @param ValueType Type of the elements of the views.
+ * @param pointers As many `*` as the rank.
+ */
+#define BRAK_PREBUILT_RANK(EXTERN, rank, ValueType, pointers)                  \
+  BRAK_PREBUILT_CHAIN_##rank(EXTERN, Kokkos::View<ValueType pointers>)         \
+  BRAK_PREBUILT_TOP(EXTERN,                                                    \
+                    Kokkos::View<ValueType pointers, Kokkos::LayoutRight>)     \
+  BRAK_PREBUILT_CHAIN_##rank(                                                  \
+      EXTERN, Kokkos::View<ValueType pointers, Kokkos::LayoutLeft>)            \
+  BRAK_PREBUILT_HOST(EXTERN, rank, ValueType, pointers)
+
+/**
+ * List the instantiations of the wrappers of views of a value type, for
+ * ranks from 1 to 8.
+ * @param EXTERN `extern` for declarations, nothing for definitions.
+ * @param ValueType Type of the elements of the views.
+ */
+#define BRAK_PREBUILT_VALUE_TYPE(EXTERN, ValueType)                            \
+  BRAK_PREBUILT_RANK(EXTERN, 1, ValueType, *)                                  \
+  BRAK_PREBUILT_RANK(EXTERN, 2, ValueType, **)                                 \
+  BRAK_PREBUILT_RANK(EXTERN, 3, ValueType, ***)                                \
+  BRAK_PREBUILT_RANK(EXTERN, 4, ValueType, ****)                               \
+  BRAK_PREBUILT_RANK(EXTERN, 5, ValueType, *****)                              \
+  BRAK_PREBUILT_RANK(EXTERN, 6, ValueType, ******)                             \
+  BRAK_PREBUILT_RANK(EXTERN, 7, ValueType, *******)                            \
+  BRAK_PREBUILT_RANK(EXTERN, 8, ValueType, ********)
+
+/**
+ * List the instantiations of the wrappers of all the common views.
+ * @param EXTERN `extern` for declarations, nothing for definitions.
+ */
+#define BRAK_PREBUILT(EXTERN)                                                  \
+  BRAK_PREBUILT_VALUE_TYPE(EXTERN, int)                                        \
+  BRAK_PREBUILT_VALUE_TYPE(EXTERN, float)                                      \
+  BRAK_PREBUILT_VALUE_TYPE(EXTERN, double)
+
+// NOTE The instantiations of the prebuilt library contain the bounds checks
+// and the profiling only if the library was built with them. Declaring them
+// in a translation unit with another configuration would silently use the
+// copies of the library for the calls that are not inlined.
+#if defined(BRAK_ENABLE_BOUNDS_CHECK) != defined(BRAK_PREBUILT_BOUNDS_CHECK)
+#error "Bounds checking must be enabled both for the prebuilt library and " \
+       "for its clients, or for none of them; link against Brak::brak instead"
+#endif
+#if defined(BRAK_ENABLE_PROFILING) != defined(BRAK_PREBUILT_PROFILING)
+#error "Profiling must be enabled both for the prebuilt library and for its " \
+       "clients, or for none of them; link against Brak::brak instead"
+#endif
+
+// declare the instantiations, which are defined in the prebuilt library
+BRAK_PREBUILT(extern)
+
+#endif // ifndef __BRAK_PREBUILT_HPP__
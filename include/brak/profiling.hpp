@@ -0,0 +1,624 @@
+#ifndef __BRAK_PROFILING_HPP__
+#define __BRAK_PROFILING_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+namespace brak::profiling {
+
+/**
+ * Maximum rank of a view.
+ */
+inline constexpr std::size_t rankMax = 8;
+
+/**
+ * Counters of the accesses to a view.
+ * The counters of the dimensions are stored from the right-most one, so that
+ * a subview of lower rank updates the same counters as the view it comes
+ * from.
+ */
+struct Record {
+  /**
+   * Largest rank the view has been accessed with.
+   */
+  std::size_t mRank = 0;
+
+  /**
+   * Number of accesses to a scalar.
+   */
+  std::uint64_t mAccesses = 0;
+
+  /**
+   * Number of escapes of the view or of its raw pointer.
+   */
+  std::uint64_t mEscapes = 0;
+
+  /**
+   * Smallest index of each dimension.
+   */
+  Kokkos::Array<std::size_t, rankMax> mIndexMin;
+
+  /**
+   * Largest index of each dimension.
+   */
+  Kokkos::Array<std::size_t, rankMax> mIndexMax;
+
+  /**
+   * Previous index of each dimension.
+   */
+  Kokkos::Array<std::size_t, rankMax> mIndexPrevious;
+
+  /**
+   * Number of indices of each dimension that repeat or follow the previous
+   * one.
+   */
+  Kokkos::Array<std::uint64_t, rankMax> mSequential;
+
+  /**
+   * Number of indices of each dimension that jump from the previous one.
+   */
+  Kokkos::Array<std::uint64_t, rankMax> mRandom;
+
+  /**
+   * Construct empty counters.
+   */
+  Record() {
+    for (std::size_t fromRight = 0; fromRight < rankMax; fromRight++) {
+      mIndexMin[fromRight] = std::numeric_limits<std::size_t>::max();
+      mIndexMax[fromRight] = 0;
+      mIndexPrevious[fromRight] = std::numeric_limits<std::size_t>::max();
+      mSequential[fromRight] = 0;
+      mRandom[fromRight] = 0;
+    }
+  }
+
+  /**
+   * Record an index of a dimension.
+   * @param fromRight Dimension, starting from 0 for the right-most one.
+   * @param index Index.
+   */
+  void recordIndex(std::size_t const fromRight, std::size_t const index) {
+    mIndexMin[fromRight] = std::min(mIndexMin[fromRight], index);
+    mIndexMax[fromRight] = std::max(mIndexMax[fromRight], index);
+
+    std::size_t const previous = mIndexPrevious[fromRight];
+    // NOTE The previous index is initialized to the largest value, so that
+    // the first index 0 is considered as following it.
+    if (index == previous || index == previous + 1) {
+      mSequential[fromRight]++;
+    } else {
+      mRandom[fromRight]++;
+    }
+    mIndexPrevious[fromRight] = index;
+  }
+
+  /**
+   * Add the counters of another record.
+   * @param other Other record.
+   */
+  void merge(Record const &other) {
+    mRank = std::max(mRank, other.mRank);
+    mAccesses += other.mAccesses;
+    mEscapes += other.mEscapes;
+    for (std::size_t fromRight = 0; fromRight < rankMax; fromRight++) {
+      mIndexMin[fromRight] =
+          std::min(mIndexMin[fromRight], other.mIndexMin[fromRight]);
+      mIndexMax[fromRight] =
+          std::max(mIndexMax[fromRight], other.mIndexMax[fromRight]);
+      mSequential[fromRight] += other.mSequential[fromRight];
+      mRandom[fromRight] += other.mRandom[fromRight];
+    }
+  }
+};
+
+/**
+ * Records of the accesses of a thread, per view label and per kernel.
+ * The records of a view are looked up from the address of its data, and its
+ * label is only built at the first access to this address, so that an access
+ * does not build nor hash a string.
+ */
+class Registry {
+  /**
+   * Records per view label, then per kernel identifier.
+   */
+  std::unordered_map<std::string, std::unordered_map<std::size_t, Record>>
+      mRecords;
+
+  /**
+   * Records per kernel identifier, per address of the data of a view.
+   * The records are owned by `mRecords`, whose elements are never moved.
+   */
+  std::unordered_map<void const *, std::unordered_map<std::size_t, Record> *>
+      mRecordsData;
+
+  /**
+   * Number of deallocations of data when the addresses were looked up.
+   */
+  std::uint64_t mDeallocations = 0;
+
+  /**
+   * Address of the data of the last accessed view.
+   */
+  void const *mDataLast = nullptr;
+
+  /**
+   * Identifier of the kernel of the last access.
+   */
+  std::size_t mKernelLast = 0;
+
+  /**
+   * Record of the last accessed view in the kernel of the last access.
+   */
+  Record *mRecordLast = nullptr;
+
+public:
+  /**
+   * Get the record of a view in a kernel.
+   * @tparam View Type of the view (automatically deduced).
+   * @param data View.
+   * @param kernel Identifier of the current kernel.
+   * @param deallocations Number of deallocations of data so far. When it
+   * changes, the address of a freed view may be reused by another view, so
+   * the addresses are looked up again.
+   * @return Reference to the record of the label of the view in the kernel.
+   */
+  template <typename View>
+  Record &getRecord(View const &data, std::size_t const kernel,
+                    std::uint64_t const deallocations) {
+    if (deallocations != mDeallocations) {
+      mRecordsData.clear();
+      mRecordLast = nullptr;
+      mDeallocations = deallocations;
+    }
+
+    void const *const address = data.data();
+    if (mRecordLast != nullptr && address == mDataLast &&
+        kernel == mKernelLast) {
+      return *mRecordLast;
+    }
+
+    std::unordered_map<std::size_t, Record> *&records = mRecordsData[address];
+    if (records == nullptr) {
+      // NOTE Subviews have different addresses but the same label, so that
+      // they share the records of the view they come from.
+      records = &mRecords[data.label()];
+    }
+    Record &record = (*records)[kernel];
+    mDataLast = address;
+    mKernelLast = kernel;
+    mRecordLast = &record;
+
+    return record;
+  }
+
+  /**
+   * Get the records per view label and per kernel identifier.
+   * @return Reference to the records.
+   */
+  std::unordered_map<std::string,
+                     std::unordered_map<std::size_t, Record>> const &
+  getRecords() const {
+    return mRecords;
+  }
+
+  /**
+   * Clear the records.
+   */
+  void clear() {
+    mRecords.clear();
+    mRecordsData.clear();
+    mDataLast = nullptr;
+    mKernelLast = 0;
+    mRecordLast = nullptr;
+  }
+};
+
+/**
+ * Collection of the records of all the threads.
+ * Each thread updates its own registry without synchronization; only the
+ * creation of a registry, once per thread, takes a lock.
+ * The accesses are attributed to the innermost kernel or profiling region,
+ * which is tracked with the callbacks of Kokkos Tools. The callbacks of a
+ * tool loaded before still receive the events.
+ */
+class Profiler {
+  /**
+   * Mutex protecting the list of registries and the names of the kernels.
+   */
+  std::mutex mMutex;
+
+  /**
+   * Registries of all the threads.
+   * They are shared with the threads, so that they outlive them.
+   */
+  std::vector<std::shared_ptr<Registry>> mRegistries;
+
+  /**
+   * Names of the kernels and regions, per identifier.
+   * The identifier 0 stands for the accesses outside any kernel or region.
+   */
+  std::vector<std::string> mKernels{std::string()};
+
+  /**
+   * Identifiers of the kernels and regions, per name.
+   */
+  std::unordered_map<std::string, std::size_t> mKernelsId;
+
+  /**
+   * Identifiers of the nested kernels and regions, the innermost one last.
+   */
+  std::vector<std::size_t> mKernelsStack;
+
+  /**
+   * Identifier of the innermost current kernel or region.
+   * It is set by the thread launching the kernels, and read by the threads
+   * running them.
+   */
+  std::atomic<std::size_t> mKernelCurrent{0};
+
+  /**
+   * Number of deallocations of data.
+   */
+  std::atomic<std::uint64_t> mDeallocations{0};
+
+  /**
+   * Callbacks of Kokkos Tools set before the ones of the profiler.
+   */
+  Kokkos::Tools::Experimental::EventSet mCallbacksPrevious;
+
+  /**
+   * Construct the profiler, set its callbacks of Kokkos Tools, and dump its
+   * summary at the finalization of Kokkos.
+   */
+  Profiler()
+      : mCallbacksPrevious(Kokkos::Tools::Experimental::get_callbacks()) {
+    using Kokkos::Tools::Experimental::EventSet;
+    namespace tools = Kokkos::Tools::Experimental;
+
+    tools::set_begin_parallel_for_callback(
+        beginKernel<&EventSet::begin_parallel_for>);
+    tools::set_begin_parallel_reduce_callback(
+        beginKernel<&EventSet::begin_parallel_reduce>);
+    tools::set_begin_parallel_scan_callback(
+        beginKernel<&EventSet::begin_parallel_scan>);
+    tools::set_end_parallel_for_callback(
+        endKernel<&EventSet::end_parallel_for>);
+    tools::set_end_parallel_reduce_callback(
+        endKernel<&EventSet::end_parallel_reduce>);
+    tools::set_end_parallel_scan_callback(
+        endKernel<&EventSet::end_parallel_scan>);
+    tools::set_push_region_callback(pushRegion);
+    tools::set_pop_region_callback(popRegion);
+    tools::set_deallocate_data_callback(deallocateData);
+
+    Kokkos::push_finalize_hook([]() { dump(std::cout); });
+  }
+
+public:
+  /**
+   * Get the unique instance of the profiler.
+   * @return Reference to the profiler.
+   */
+  static Profiler &getInstance() {
+    static Profiler profiler;
+    return profiler;
+  }
+
+  /**
+   * Get the registry of the calling thread.
+   * @return Reference to the registry.
+   */
+  Registry &getThreadRegistry() {
+    thread_local std::shared_ptr<Registry> const registry = [this]() {
+      auto const registryNew = std::make_shared<Registry>();
+      std::lock_guard<std::mutex> const lock(mMutex);
+      mRegistries.push_back(registryNew);
+      return registryNew;
+    }();
+
+    return *registry;
+  }
+
+  /**
+   * Get the record of a view in the current kernel, for the calling thread.
+   * @tparam View Type of the view (automatically deduced).
+   * @param data View.
+   * @return Reference to the record.
+   */
+  template <typename View> Record &getRecord(View const &data) {
+    return getThreadRegistry().getRecord(
+        data, mKernelCurrent.load(std::memory_order_relaxed),
+        mDeallocations.load(std::memory_order_relaxed));
+  }
+
+  /**
+   * Merge the records of all the threads, per kernel.
+   * @return Records per view label, then per kernel or region name, sorted
+   * by names. The accesses outside any kernel or region have an empty name.
+   * @note This method must not be called while other threads are accessing
+   * wrappers.
+   */
+  std::map<std::string, std::map<std::string, Record>> collectKernels() {
+    std::lock_guard<std::mutex> const lock(mMutex);
+    std::map<std::string, std::map<std::string, Record>> records;
+    for (auto const &registry : mRegistries) {
+      for (auto const &[label, recordsKernels] : registry->getRecords()) {
+        for (auto const &[kernel, record] : recordsKernels) {
+          records[label][mKernels[kernel]].merge(record);
+        }
+      }
+    }
+
+    return records;
+  }
+
+  /**
+   * Merge the records of all the threads.
+   * @return Records per view label, sorted by label.
+   * @note This method must not be called while other threads are accessing
+   * wrappers.
+   */
+  std::map<std::string, Record> collect() {
+    std::map<std::string, Record> records;
+    for (auto const &[label, recordsKernels] : collectKernels()) {
+      for (auto const &[kernel, record] : recordsKernels) {
+        records[label].merge(record);
+      }
+    }
+
+    return records;
+  }
+
+  /**
+   * Clear the records of all the threads.
+   * @note This method must not be called while other threads are accessing
+   * wrappers.
+   */
+  void reset() {
+    std::lock_guard<std::mutex> const lock(mMutex);
+    for (auto const &registry : mRegistries) {
+      registry->clear();
+    }
+  }
+
+  /**
+   * Write a summary of the records of all the threads.
+   * @param stream Output stream.
+   */
+  static void dump(std::ostream &stream) {
+    stream << "brak: access profile\n";
+    for (auto const &[label, recordsKernels] :
+         getInstance().collectKernels()) {
+      Record record;
+      for (auto const &[kernel, recordKernel] : recordsKernels) {
+        record.merge(recordKernel);
+      }
+
+      stream << "view \"" << label << "\": " << record.mAccesses
+             << " accesses, " << record.mEscapes << " escapes\n";
+      for (std::size_t dimension = 0; dimension < record.mRank; dimension++) {
+        std::size_t const fromRight = record.mRank - 1 - dimension;
+        if (record.mSequential[fromRight] + record.mRandom[fromRight] == 0) {
+          continue;
+        }
+        stream << "  dimension " << dimension << ": indices ["
+               << record.mIndexMin[fromRight] << ", "
+               << record.mIndexMax[fromRight] << "], "
+               << record.mSequential[fromRight] << " sequential, "
+               << record.mRandom[fromRight] << " random\n";
+      }
+      for (auto const &[kernel, recordKernel] : recordsKernels) {
+        if (kernel.empty()) {
+          stream << "  outside kernels: ";
+        } else {
+          stream << "  kernel \"" << kernel << "\": ";
+        }
+        stream << recordKernel.mAccesses << " accesses, "
+               << recordKernel.mEscapes << " escapes\n";
+      }
+    }
+  }
+
+private:
+  /**
+   * Enter a kernel or a region.
+   * @param name Name of the kernel or region.
+   */
+  void pushKernel(char const *const name) {
+    std::lock_guard<std::mutex> const lock(mMutex);
+    auto const [iterator, isInserted] =
+        mKernelsId.try_emplace(name, mKernels.size());
+    if (isInserted) {
+      mKernels.push_back(iterator->first);
+    }
+    mKernelsStack.push_back(iterator->second);
+    mKernelCurrent.store(iterator->second, std::memory_order_relaxed);
+  }
+
+  /**
+   * Leave the innermost kernel or region.
+   */
+  void popKernel() {
+    std::lock_guard<std::mutex> const lock(mMutex);
+    if (!mKernelsStack.empty()) {
+      mKernelsStack.pop_back();
+    }
+    mKernelCurrent.store(mKernelsStack.empty() ? 0 : mKernelsStack.back(),
+                         std::memory_order_relaxed);
+  }
+
+  /**
+   * Callback of Kokkos Tools at the beginning of a kernel.
+   * @tparam callback Member of the previous callbacks to forward the event
+   * to.
+   * @param name Name of the kernel.
+   * @param deviceId Identifier of the device.
+   * @param kernelId Identifier of the kernel, set by the previous tool.
+   */
+  template <Kokkos::Tools::beginFunction Kokkos::Tools::Experimental::
+                EventSet::*callback>
+  static void beginKernel(char const *const name, std::uint32_t const deviceId,
+                          std::uint64_t *const kernelId) {
+    Profiler &profiler = getInstance();
+    profiler.pushKernel(name);
+    if (profiler.mCallbacksPrevious.*callback != nullptr) {
+      (profiler.mCallbacksPrevious.*callback)(name, deviceId, kernelId);
+    }
+  }
+
+  /**
+   * Callback of Kokkos Tools at the end of a kernel.
+   * @tparam callback Member of the previous callbacks to forward the event
+   * to.
+   * @param kernelId Identifier of the kernel.
+   */
+  template <Kokkos::Tools::endFunction Kokkos::Tools::Experimental::EventSet::
+                *callback>
+  static void endKernel(std::uint64_t const kernelId) {
+    Profiler &profiler = getInstance();
+    profiler.popKernel();
+    if (profiler.mCallbacksPrevious.*callback != nullptr) {
+      (profiler.mCallbacksPrevious.*callback)(kernelId);
+    }
+  }
+
+  /**
+   * Callback of Kokkos Tools at the beginning of a region.
+   * @param name Name of the region.
+   */
+  static void pushRegion(char const *const name) {
+    Profiler &profiler = getInstance();
+    profiler.pushKernel(name);
+    if (profiler.mCallbacksPrevious.push_region != nullptr) {
+      profiler.mCallbacksPrevious.push_region(name);
+    }
+  }
+
+  /**
+   * Callback of Kokkos Tools at the end of a region.
+   */
+  static void popRegion() {
+    Profiler &profiler = getInstance();
+    profiler.popKernel();
+    if (profiler.mCallbacksPrevious.pop_region != nullptr) {
+      profiler.mCallbacksPrevious.pop_region();
+    }
+  }
+
+  /**
+   * Callback of Kokkos Tools at the deallocation of data.
+   * @param handle Handle of the memory space.
+   * @param label Label of the data.
+   * @param pointer Address of the data.
+   * @param size Size of the data, in bytes.
+   */
+  static void deallocateData(Kokkos::Tools::SpaceHandle const handle,
+                             char const *const label,
+                             void const *const pointer,
+                             std::uint64_t const size) {
+    Profiler &profiler = getInstance();
+    profiler.mDeallocations.fetch_add(1, std::memory_order_relaxed);
+    if (profiler.mCallbacksPrevious.deallocate_data != nullptr) {
+      profiler.mCallbacksPrevious.deallocate_data(handle, label, pointer,
+                                                  size);
+    }
+  }
+};
+
+/**
+ * Record indices of an access to a view, on host.
+ * If the indices reach the last dimension of the view, the access to a
+ * scalar is counted.
+ * @tparam View Type of the view (automatically deduced).
+ * @tparam IndexType Type of the indices (automatically deduced).
+ * @tparam size Number of indices (automatically deduced).
+ * @param data Accessed view.
+ * @param first First dimension to record.
+ * @param indices Array of the indices of the access, starting from the
+ * left-most dimension of the view.
+ */
+template <typename View, typename IndexType, std::size_t size>
+void record_indices(View const &data, std::size_t const first,
+                    Kokkos::Array<IndexType, size> const &indices) {
+  static_assert(View::rank() <= rankMax, "Rank of view too large");
+
+  Record &record = Profiler::getInstance().getRecord(data);
+  record.mRank = std::max(record.mRank, std::size_t(View::rank()));
+  for (std::size_t dimension = first; dimension < size; dimension++) {
+    record.recordIndex(View::rank() - 1 - dimension,
+                       static_cast<std::size_t>(indices[dimension]));
+  }
+  if (size == View::rank()) {
+    record.mAccesses++;
+  }
+}
+
+/**
+ * Record indices of an access to a view, on host.
+ * @tparam View Type of the view (automatically deduced).
+ * @tparam IndicesType Type of the indices (automatically deduced).
+ * @param data Accessed view.
+ * @param first First dimension to record.
+ * @param indices Pack of the indices of the access.
+ */
+template <typename View, typename... IndicesType>
+void record_indices(View const &data, std::size_t const first,
+                    IndicesType const... indices) {
+  record_indices(data, first,
+                 Kokkos::Array<std::size_t, sizeof...(indices)>{
+                     {static_cast<std::size_t>(indices)...}});
+}
+
+/**
+ * Record an escape of a view or of its raw pointer, on host.
+ * @tparam View Type of the view (automatically deduced).
+ * @param data Escaped view.
+ */
+template <typename View> void record_escape(View const &data) {
+  Profiler::getInstance().getRecord(data).mEscapes++;
+}
+
+} // namespace brak::profiling
+
+/**
+ * Record indices of an access to a view when the library is built with
+ * `BRAK_ENABLE_PROFILING`, and do nothing otherwise.
+ * Accesses on device are not recorded.
+ * @param data Accessed view.
+ * @param first First dimension to record.
+ * @param ... Array or pack of the indices of the access.
+ */
+#ifdef BRAK_ENABLE_PROFILING
+#define BRAK_PROFILE_INDICES(data, first, ...)                                 \
+  KOKKOS_IF_ON_HOST(                                                           \
+      (::brak::profiling::record_indices(data, first, __VA_ARGS__);))
+#else
+#define BRAK_PROFILE_INDICES(data, first, ...) static_cast<void>(0)
+#endif
+
+/**
+ * Record an escape of a view or of its raw pointer when the library is built
+ * with `BRAK_ENABLE_PROFILING`, and do nothing otherwise.
+ * Escapes on device are not recorded.
+ * @param data Escaped view.
+ */
+#ifdef BRAK_ENABLE_PROFILING
+#define BRAK_PROFILE_ESCAPE(data)                                              \
+  KOKKOS_IF_ON_HOST((::brak::profiling::record_escape(data);))
+#else
+#define BRAK_PROFILE_ESCAPE(data) static_cast<void>(0)
+#endif
+
+#endif // ifndef __BRAK_PROFILING_HPP__
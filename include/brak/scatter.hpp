@@ -0,0 +1,217 @@
+#ifndef __BRAK_SCATTER_HPP__
+#define __BRAK_SCATTER_HPP__
+
+#include <cstddef>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
+
+namespace brak {
+
+/**
+ * Brackets access to a scatter view, obtained in a kernel.
+ * @tparam Access Type of the access to the scatter view.
+ * @tparam rank Rank of the scatter view.
+ * @tparam depth Current depth of the wrapper.
+ */
+template <typename Access, std::size_t rank, std::size_t depth = 0>
+class WrapperScatterAccess {
+  /**
+   * Access to the scatter view.
+   */
+  Access mAccess;
+
+  /**
+   * Array of the indices.
+   */
+  Kokkos::Array<std::size_t, depth> mIndices;
+
+public:
+  /**
+   * Construct a wrapper from an access to a scatter view.
+   * @param access Access to the scatter view.
+   */
+  KOKKOS_FUNCTION
+  explicit WrapperScatterAccess(Access const &access) : mAccess(access) {}
+
+  /**
+   * Construct a sub-wrapper from an access and an array of indices.
+   * @param access Access to the scatter view.
+   * @param indices Array of indices above the sub-wrapper.
+   */
+  KOKKOS_FUNCTION
+  WrapperScatterAccess(Access const &access,
+                       Kokkos::Array<std::size_t, depth> const &indices)
+      : mAccess(access), mIndices(indices) {}
+
+  /**
+   * Get the current rank of the wrapper.
+   * @return Rank of the wrapper.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return rank - depth; }
+
+  /**
+   * Create a sub-wrapper with a rank lowered by 1.
+   * @param index Left-most index to extract from the scatter view.
+   * @return A sub-wrapper or a proxy to a scalar if the current wrapper has a
+   * dimension of 1. The proxy only supports accumulations, like `+=`.
+   */
+  KOKKOS_FUNCTION
+  decltype(auto) operator[](std::size_t const index) const {
+    Kokkos::Array<std::size_t, depth + 1> indices =
+        extendIndices(std::make_index_sequence<depth>(), index);
+
+    if constexpr (getRank() > 1) {
+      return WrapperScatterAccess<Access, rank, depth + 1>(mAccess, indices);
+    } else {
+      return getValue(indices, std::make_index_sequence<rank>());
+    }
+  }
+
+  /**
+   * Directly access to a scalar value.
+   * @tparam IndicesType Type of the indices. They will be casted to
+   * `std::size_t`.
+   * @param indices Pack of indices. The number of indices must match the rank
+   * of the current wrapper.
+   * @return Proxy to a scalar of the scatter view at the given indices.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION decltype(auto)
+  operator()(IndicesType const... indices) const {
+    static_assert(sizeof...(indices) == getRank(), "Rank mismatch");
+
+    return getValue(extendIndices(std::make_index_sequence<depth>(),
+                                  static_cast<std::size_t>(indices)...),
+                    std::make_index_sequence<rank>());
+  }
+
+private:
+  /**
+   * Recreate an array of indices with new indices and an index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @tparam IndicesType Type of the indices.
+   * @param indexSequenceArg Index sequence of the indices from 0 to `depth` to
+   * access `mIndices`.
+   * @param indices Pack of indices.
+   * @return Extended array of indices.
+   */
+  template <std::size_t... indexSequence, typename... IndicesType>
+  KOKKOS_FUNCTION Kokkos::Array<std::size_t, depth + sizeof...(IndicesType)>
+  extendIndices(
+      [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg,
+      IndicesType const... indices) const {
+    return {{mIndices[indexSequence]..., indices...}};
+  }
+
+  /**
+   * Get the proxy to a scalar of the scatter view from an array of indices
+   * and an index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @param indices Array of indices of all the dimensions.
+   * @param indexSequenceArg Index sequence of the indices from 0 to `rank` to
+   * access `indices`.
+   * @return Proxy to a scalar.
+   */
+  template <std::size_t... indexSequence>
+  KOKKOS_FUNCTION decltype(auto)
+  getValue(Kokkos::Array<std::size_t, rank> const &indices,
+           [[maybe_unused]] std::index_sequence<indexSequence...>
+               indexSequenceArg) const {
+    return mAccess(indices[indexSequence]...);
+  }
+};
+
+/**
+ * Wrapper of a scatter view over a view, for concurrent accumulations.
+ * Following the defaults of Kokkos, the scatter view duplicates the data on
+ * host backends, and uses atomics on device backends.
+ * @tparam View Type of the view to accumulate into.
+ */
+template <typename View> class WrapperScatter {
+  /**
+   * Type of the scatter view.
+   */
+  using ScatterView = Kokkos::Experimental::ScatterView<
+      typename View::traits::data_type, typename View::traits::array_layout,
+      typename View::traits::device_type>;
+
+  /**
+   * View to accumulate into.
+   */
+  View mData;
+  static_assert(Kokkos::is_view<View>::value);
+
+  /**
+   * Scatter view.
+   */
+  ScatterView mScatter;
+
+public:
+  /**
+   * Construct a wrapper from a view.
+   * @param data View to accumulate into.
+   */
+  explicit WrapperScatter(View const data) : mData(data), mScatter(data) {}
+
+  /**
+   * Get the rank of the wrapped view.
+   * @return Rank of the wrapped view.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return View::rank(); }
+
+  /**
+   * Get an access to the scatter view, to be called in a kernel.
+   * @return Brackets access to the scatter view.
+   */
+  KOKKOS_FUNCTION
+  auto access() const {
+    using Access = decltype(mScatter.access());
+
+    return WrapperScatterAccess<Access, View::rank()>(mScatter.access());
+  }
+
+  /**
+   * Add the accumulations into the wrapped view, and reset the scatter view
+   * for the next accumulations.
+   */
+  void contribute() {
+    Kokkos::Experimental::contribute(mData, mScatter);
+    mScatter.reset();
+  }
+};
+
+/**
+ * Create a scatter wrapper from a view.
+ * @tparam View Type of the view (automatically deduced).
+ * @param data View to accumulate into.
+ * @return Scatter wrapper of the view.
+ */
+template <typename View,
+          std::enable_if_t<Kokkos::is_view<View>::value, int> = 0>
+WrapperScatter<View> scatter(View const data) {
+  return WrapperScatter<View>(data);
+}
+
+/**
+ * Create a scatter wrapper from a wrapper.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper of the view to accumulate into. It must be a
+ * top-level wrapper.
+ * @return Scatter wrapper of the wrapped view.
+ */
+template <typename Wrapper,
+          std::enable_if_t<!Kokkos::is_view<Wrapper>::value, int> = 0>
+auto scatter(Wrapper const &wrapper) {
+  static_assert(Wrapper::getRank() == Wrapper::getRankSource(),
+                "Scatter wrapper can only be created from a top-level wrapper");
+
+  return scatter(wrapper.getView());
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_SCATTER_HPP__
@@ -0,0 +1,75 @@
+#ifndef __BRAK_SCRATCH_HPP__
+#define __BRAK_SCRATCH_HPP__
+
+#include <cstddef>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/wrapper_array.hpp"
+
+namespace brak {
+
+/**
+ * Type of an unmanaged view in the scratch memory of a team.
+ * @tparam DataType Data type of the view, like `double[4][4][4]` for static
+ * extents, or `double *[4][4]` for a mix of dynamic and static extents.
+ * @tparam ScratchMemorySpace Scratch memory space of the team.
+ */
+template <typename DataType, typename ScratchMemorySpace>
+using scratch_view_t =
+    Kokkos::View<DataType, ScratchMemorySpace,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+/**
+ * Get the size of the scratch memory needed by a scratch wrapper, to be given
+ * to the team policy with `set_scratch_size`.
+ * @tparam DataType Data type of the wrapped view.
+ * @tparam ExecutionSpace Execution space of the team policy.
+ * @tparam ExtentsType Type of the extents (automatically deduced).
+ * @param extents Pack of dynamic extents of the wrapped view, if any.
+ * @return Size of the scratch memory in bytes.
+ */
+template <typename DataType,
+          typename ExecutionSpace = Kokkos::DefaultExecutionSpace,
+          typename... ExtentsType>
+std::size_t scratch_size(ExtentsType const... extents) {
+  using ScratchView =
+      scratch_view_t<DataType, typename ExecutionSpace::scratch_memory_space>;
+  static_assert(sizeof...(extents) == ScratchView::rank_dynamic(),
+                "The number of extents must match the dynamic rank");
+
+  return ScratchView::shmem_size(extents...);
+}
+
+/**
+ * Allocate a view in the scratch memory of a team and create an array
+ * wrapper of it, to be called in a kernel of a team policy.
+ * The view is unmanaged, and is valid until the end of the team kernel. The
+ * team policy must reserve enough scratch memory, as given by
+ * `brak::scratch_size`.
+ * @tparam DataType Data type of the wrapped view, like `double[4][4][4]` for
+ * static extents.
+ * @tparam TeamMember Type of the team member (automatically deduced).
+ * @tparam ExtentsType Type of the extents (automatically deduced).
+ * @param team Team member handle.
+ * @param level Level of the scratch memory, 0 for the fastest and smallest
+ * one.
+ * @param extents Pack of dynamic extents of the wrapped view, if any.
+ * @return Array wrapper of the scratch view.
+ */
+template <typename DataType, typename TeamMember, typename... ExtentsType>
+KOKKOS_FUNCTION auto make_scratch_wrapper(TeamMember const &team,
+                                          int const level = 0,
+                                          ExtentsType const... extents) {
+  using ScratchView =
+      scratch_view_t<DataType, typename TeamMember::scratch_memory_space>;
+  static_assert(sizeof...(extents) == ScratchView::rank_dynamic(),
+                "The number of extents must match the dynamic rank");
+
+  return WrapperArray<ScratchView>(
+      ScratchView(team.team_scratch(level), extents...));
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_SCRATCH_HPP__
@@ -0,0 +1,163 @@
+#ifndef __BRAK_SIMD_HPP__
+#define __BRAK_SIMD_HPP__
+
+#include <cstddef>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+namespace brak {
+
+/**
+ * SIMD type of the native width of the target.
+ * @tparam ValueType Type of the elements.
+ */
+template <typename ValueType>
+using native_simd = Kokkos::Experimental::native_simd<ValueType>;
+
+/**
+ * SIMD type matching the elements of a wrapper of rank 1.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Wrapper>
+using wrapper_simd = native_simd<std::remove_cv_t<
+    std::remove_reference_t<decltype(*std::declval<Wrapper>().begin())>>>;
+
+/**
+ * Create the mask of the first lanes of a SIMD type.
+ * @tparam Simd SIMD type.
+ * @param count Number of active lanes.
+ * @return Mask where the `count` first lanes are active.
+ */
+template <typename Simd>
+KOKKOS_FUNCTION typename Simd::mask_type
+make_tail_mask(std::size_t const count) {
+  using ValueType = typename Simd::value_type;
+
+  Simd const lanes(
+      [](std::size_t const lane) { return static_cast<ValueType>(lane); });
+
+  return lanes < Simd(static_cast<ValueType>(count));
+}
+
+/**
+ * Load a full SIMD vector from a wrapper of rank 1.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper of rank 1.
+ * @param index Index of the first element to load.
+ * @return SIMD vector of the elements from `index`.
+ * @note If the elements of the wrapper are not known to be contiguous at
+ * compile time, they are gathered one by one.
+ */
+template <typename Wrapper>
+KOKKOS_FUNCTION wrapper_simd<Wrapper> simd_load(Wrapper const &wrapper,
+                                                std::size_t const index) {
+  using Simd = wrapper_simd<Wrapper>;
+
+  auto const iterator = wrapper.begin() + index;
+
+  if constexpr (std::is_pointer_v<decltype(iterator)>) {
+    // contiguous elements, load the vector at once
+    Simd value;
+    value.copy_from(iterator, Kokkos::Experimental::element_aligned_tag());
+    return value;
+  } else {
+    // strided elements, gather them
+    return Simd([&](std::size_t const lane) { return iterator[lane]; });
+  }
+}
+
+/**
+ * Load a partial SIMD vector from a wrapper of rank 1.
+ * This is typically used for the tail of a loop.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper of rank 1.
+ * @param index Index of the first element to load.
+ * @param count Number of elements to load. The other lanes are set to 0.
+ * @return SIMD vector of the `count` elements from `index`.
+ */
+template <typename Wrapper>
+KOKKOS_FUNCTION wrapper_simd<Wrapper>
+simd_load_masked(Wrapper const &wrapper, std::size_t const index,
+                 std::size_t const count) {
+  using Simd = wrapper_simd<Wrapper>;
+  using ValueType = typename Simd::value_type;
+
+  auto const iterator = wrapper.begin() + index;
+
+  if constexpr (std::is_pointer_v<decltype(iterator)>) {
+    // contiguous elements, load the active lanes at once
+    Simd value(ValueType(0));
+    Kokkos::Experimental::where(make_tail_mask<Simd>(count), value)
+        .copy_from(iterator, Kokkos::Experimental::element_aligned_tag());
+    return value;
+  } else {
+    // strided elements, gather the active lanes
+    return Simd([&](std::size_t const lane) {
+      return lane < count ? static_cast<ValueType>(iterator[lane])
+                          : ValueType(0);
+    });
+  }
+}
+
+/**
+ * Store a full SIMD vector in a wrapper of rank 1.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper of rank 1.
+ * @param index Index of the first element to store.
+ * @param value SIMD vector to store.
+ * @note If the elements of the wrapper are not known to be contiguous at
+ * compile time, they are scattered one by one.
+ */
+template <typename Wrapper>
+KOKKOS_FUNCTION void simd_store(Wrapper const &wrapper,
+                                std::size_t const index,
+                                wrapper_simd<Wrapper> const &value) {
+  auto const iterator = wrapper.begin() + index;
+
+  if constexpr (std::is_pointer_v<decltype(iterator)>) {
+    // contiguous elements, store the vector at once
+    value.copy_to(iterator, Kokkos::Experimental::element_aligned_tag());
+  } else {
+    // strided elements, scatter them
+    for (std::size_t lane = 0; lane < value.size(); lane++) {
+      iterator[lane] = value[lane];
+    }
+  }
+}
+
+/**
+ * Store a partial SIMD vector in a wrapper of rank 1.
+ * This is typically used for the tail of a loop.
+ * @tparam Wrapper Type of the wrapper (automatically deduced).
+ * @param wrapper Wrapper of rank 1.
+ * @param index Index of the first element to store.
+ * @param value SIMD vector to store.
+ * @param count Number of elements to store. The other elements of the
+ * wrapper are left untouched.
+ */
+template <typename Wrapper>
+KOKKOS_FUNCTION void simd_store_masked(Wrapper const &wrapper,
+                                       std::size_t const index,
+                                       wrapper_simd<Wrapper> const &value,
+                                       std::size_t const count) {
+  using Simd = wrapper_simd<Wrapper>;
+
+  auto const iterator = wrapper.begin() + index;
+
+  if constexpr (std::is_pointer_v<decltype(iterator)>) {
+    // contiguous elements, store the active lanes at once
+    Kokkos::Experimental::where(make_tail_mask<Simd>(count), value)
+        .copy_to(iterator, Kokkos::Experimental::element_aligned_tag());
+  } else {
+    // strided elements, scatter the active lanes
+    for (std::size_t lane = 0; lane < value.size() && lane < count; lane++) {
+      iterator[lane] = value[lane];
+    }
+  }
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_SIMD_HPP__
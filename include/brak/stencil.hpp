@@ -0,0 +1,130 @@
+#ifndef __BRAK_STENCIL_HPP__
+#define __BRAK_STENCIL_HPP__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+namespace brak {
+
+/**
+ * Check if the elements of a wrapper are separated by a constant stride in
+ * each dimension, which excludes tiled wrappers.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Wrapper, typename = void>
+struct is_strided : std::false_type {};
+
+template <typename Wrapper>
+struct is_strided<Wrapper, std::void_t<decltype(std::declval<Wrapper const &>()
+                                                    .getStride(0))>>
+    : std::true_type {};
+
+/**
+ * Neighbourhood of a point of a wrapper, accessed with offsets known at
+ * compile time.
+ * The location of the point is computed once, and each neighbour is then
+ * accessed with a displacement from it.
+ * @tparam Wrapper Type of the wrapper.
+ */
+template <typename Wrapper> class Stencil {
+  static_assert(is_strided<Wrapper>::value,
+                "Stencils are not available for a tiled wrapper");
+
+  /**
+   * Type of the elements of the wrapper.
+   */
+  using ValueType = std::remove_pointer_t<decltype(*std::declval<Wrapper &>())>;
+
+  /**
+   * Pointer to the point the stencil is anchored at.
+   */
+  ValueType *mCenter;
+
+  /**
+   * Strides of the dimensions of the wrapper.
+   */
+  Kokkos::Array<std::ptrdiff_t, Wrapper::getRank()> mStrides;
+
+public:
+  /**
+   * Construct a stencil anchored at a point of a wrapper.
+   * @tparam IndicesType Type of the indices.
+   * @param wrapper Wrapper to access.
+   * @param indices Pack of indices of the point. The number of indices must
+   * match the rank of the wrapper.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION Stencil(Wrapper const &wrapper,
+                          IndicesType const... indices)
+      : mCenter(&wrapper(indices...)),
+        mStrides(getStrides(wrapper,
+                            std::make_index_sequence<Wrapper::getRank()>())) {
+    static_assert(sizeof...(indices) == Wrapper::getRank(), "Rank mismatch");
+  }
+
+  /**
+   * Get the rank of the stencil.
+   * @return Rank of the wrapper.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return Wrapper::getRank(); }
+
+  /**
+   * Access to a neighbour of the point.
+   * @tparam offsets Pack of offsets of the neighbour relatively to the point.
+   * The number of offsets must match the rank of the wrapper.
+   * @return Reference to the scalar of the neighbour.
+   */
+  template <int... offsets> KOKKOS_FUNCTION ValueType &at() const {
+    static_assert(sizeof...(offsets) == getRank(), "Rank mismatch");
+
+    return mCenter[getDisplacement<offsets...>(
+        std::make_index_sequence<getRank()>())];
+  }
+
+  /**
+   * Access to the point.
+   * @return Reference to the scalar of the point.
+   */
+  KOKKOS_FUNCTION
+  ValueType &operator()() const { return *mCenter; }
+
+private:
+  /**
+   * Get the strides of a wrapper from an index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @param wrapper Wrapper to access.
+   * @param indexSequenceArg Index sequence of the dimensions of the wrapper.
+   * @return Array of strides.
+   */
+  template <std::size_t... indexSequence>
+  KOKKOS_FUNCTION static Kokkos::Array<std::ptrdiff_t, Wrapper::getRank()>
+  getStrides(Wrapper const &wrapper,
+             [[maybe_unused]] std::index_sequence<indexSequence...>
+                 indexSequenceArg) {
+    return {{static_cast<std::ptrdiff_t>(wrapper.getStride(indexSequence))...}};
+  }
+
+  /**
+   * Get the displacement of a neighbour from an index sequence.
+   * As the offsets are known at compile time, the product with the strides
+   * reduces to additions and subtractions.
+   * @tparam offsets Pack of offsets of the neighbour.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @param indexSequenceArg Index sequence of the dimensions of the wrapper.
+   * @return Displacement of the neighbour, in number of elements.
+   */
+  template <int... offsets, std::size_t... indexSequence>
+  KOKKOS_FUNCTION std::ptrdiff_t
+  getDisplacement([[maybe_unused]] std::index_sequence<indexSequence...>
+                      indexSequenceArg) const {
+    return (std::ptrdiff_t(0) + ... + (offsets * mStrides[indexSequence]));
+  }
+};
+
+} // namespace brak
+
+#endif // ifndef __BRAK_STENCIL_HPP__
@@ -0,0 +1,218 @@
+#ifndef __BRAK_STRIDED_ITERATOR_HPP__
+#define __BRAK_STRIDED_ITERATOR_HPP__
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+namespace brak {
+
+/**
+ * Random access iterator over elements separated by a constant stride.
+ * @tparam ValueType Type of the elements.
+ */
+template <typename ValueType> class StridedIterator {
+  /**
+   * Pointer to the current element.
+   */
+  ValueType *mPointer;
+
+  /**
+   * Distance between two consecutive elements, in number of elements.
+   */
+  std::ptrdiff_t mStride;
+
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_cv_t<ValueType>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = ValueType *;
+  using reference = ValueType &;
+
+  /**
+   * Construct an empty iterator.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator() : mPointer(nullptr), mStride(1) {}
+
+  /**
+   * Construct an iterator from a pointer and a stride.
+   * @param pointer Pointer to the current element.
+   * @param stride Distance between two consecutive elements.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator(ValueType *const pointer, std::ptrdiff_t const stride)
+      : mPointer(pointer), mStride(stride) {}
+
+  /**
+   * Access the current element.
+   */
+  KOKKOS_FUNCTION
+  reference operator*() const { return *mPointer; }
+
+  /**
+   * Access the current element.
+   */
+  KOKKOS_FUNCTION
+  pointer operator->() const { return mPointer; }
+
+  /**
+   * Access an element relatively to the current one.
+   */
+  KOKKOS_FUNCTION
+  reference operator[](difference_type const offset) const {
+    return mPointer[offset * mStride];
+  }
+
+  /**
+   * Move to the next element.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator &operator++() {
+    mPointer += mStride;
+    return *this;
+  }
+
+  /**
+   * Move to the next element.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator operator++(int) {
+    StridedIterator previous = *this;
+    mPointer += mStride;
+    return previous;
+  }
+
+  /**
+   * Move to the previous element.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator &operator--() {
+    mPointer -= mStride;
+    return *this;
+  }
+
+  /**
+   * Move to the previous element.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator operator--(int) {
+    StridedIterator previous = *this;
+    mPointer -= mStride;
+    return previous;
+  }
+
+  /**
+   * Move forward by several elements.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator &operator+=(difference_type const offset) {
+    mPointer += offset * mStride;
+    return *this;
+  }
+
+  /**
+   * Move backward by several elements.
+   */
+  KOKKOS_FUNCTION
+  StridedIterator &operator-=(difference_type const offset) {
+    mPointer -= offset * mStride;
+    return *this;
+  }
+
+  /**
+   * Get an iterator moved forward by several elements.
+   */
+  KOKKOS_FUNCTION
+  friend StridedIterator operator+(StridedIterator iterator,
+                                   difference_type const offset) {
+    return iterator += offset;
+  }
+
+  /**
+   * Get an iterator moved forward by several elements.
+   */
+  KOKKOS_FUNCTION
+  friend StridedIterator operator+(difference_type const offset,
+                                   StridedIterator iterator) {
+    return iterator += offset;
+  }
+
+  /**
+   * Get an iterator moved backward by several elements.
+   */
+  KOKKOS_FUNCTION
+  friend StridedIterator operator-(StridedIterator iterator,
+                                   difference_type const offset) {
+    return iterator -= offset;
+  }
+
+  /**
+   * Get the number of elements between two iterators with the same stride.
+   */
+  KOKKOS_FUNCTION
+  friend difference_type operator-(StridedIterator const &left,
+                                   StridedIterator const &right) {
+    return (left.mPointer - right.mPointer) / left.mStride;
+  }
+
+  /**
+   * Compare two iterators.
+   */
+  KOKKOS_FUNCTION
+  friend bool operator==(StridedIterator const &left,
+                         StridedIterator const &right) {
+    return left.mPointer == right.mPointer;
+  }
+
+  /**
+   * Compare two iterators.
+   */
+  KOKKOS_FUNCTION
+  friend bool operator!=(StridedIterator const &left,
+                         StridedIterator const &right) {
+    return left.mPointer != right.mPointer;
+  }
+
+  /**
+   * Compare two iterators.
+   */
+  KOKKOS_FUNCTION
+  friend bool operator<(StridedIterator const &left,
+                        StridedIterator const &right) {
+    return (right - left) > 0;
+  }
+
+  /**
+   * Compare two iterators.
+   */
+  KOKKOS_FUNCTION
+  friend bool operator>(StridedIterator const &left,
+                        StridedIterator const &right) {
+    return right < left;
+  }
+
+  /**
+   * Compare two iterators.
+   */
+  KOKKOS_FUNCTION
+  friend bool operator<=(StridedIterator const &left,
+                         StridedIterator const &right) {
+    return !(right < left);
+  }
+
+  /**
+   * Compare two iterators.
+   */
+  KOKKOS_FUNCTION
+  friend bool operator>=(StridedIterator const &left,
+                         StridedIterator const &right) {
+    return !(left < right);
+  }
+};
+
+} // namespace brak
+
+#endif // ifndef __BRAK_STRIDED_ITERATOR_HPP__
@@ -0,0 +1,117 @@
+#ifndef __BRAK_WRAP_HPP__
+#define __BRAK_WRAP_HPP__
+
+#include <cstddef>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/kokkos_view.hpp"
+#include "brak/wrapper_array.hpp"
+
+namespace brak {
+
+/**
+ * Tag of raw arrays stored in column-major order, as Fortran arrays.
+ */
+struct ColumnMajor {};
+
+/**
+ * Tag of raw arrays stored in column-major order, to be given to
+ * `brak::wrap`.
+ */
+inline constexpr ColumnMajor column_major{};
+
+/**
+ * Type of an unmanaged view on host around raw storage.
+ * @tparam DataType Data type of the view.
+ * @tparam Layout Layout of the storage.
+ */
+template <typename DataType, typename Layout = Kokkos::LayoutRight>
+using raw_view_t = Kokkos::View<DataType, Layout, Kokkos::HostSpace,
+                                Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+/**
+ * Create an array wrapper around a C array, without copy nor allocation.
+ * The rank and the extents are deduced from the type of the array, and are
+ * known at compile time.
+ * @tparam Array Type of the C array, like `double[NX][NY][NZ]`
+ * (automatically deduced).
+ * @param data C array. It must outlive the wrapper.
+ * @return Array wrapper of an unmanaged view with a right layout.
+ */
+template <typename Array, std::enable_if_t<std::is_array_v<Array>, int> = 0>
+auto wrap(Array &data) {
+  static_assert(std::extent_v<Array> > 0,
+                "Arrays of unknown bound must be wrapped from a pointer");
+
+  using View = raw_view_t<Array>;
+  // NOTE The elements of a multi-dimensional C array are contiguous and in
+  // row-major order, as in a view with a right layout.
+
+  return WrapperArray<View>(
+      View(reinterpret_cast<std::remove_all_extents_t<Array> *>(&data)));
+}
+
+/**
+ * Create an array wrapper around a pointer to raw storage in row-major
+ * order, as allocated with `malloc`, without copy nor allocation.
+ * The pointer can point to scalars, like `double *`, or to arrays, like
+ * `double (*)[NY][NZ]`, whose extents are then known at compile time.
+ * @tparam Pointer Type of the pointer (automatically deduced).
+ * @tparam ExtentsType Type of the extents (automatically deduced).
+ * @param data Pointer to the storage. It must outlive the wrapper.
+ * @param extents Pack of extents of the left-most dimensions, which are not
+ * known from the type of the pointer.
+ * @return Array wrapper of an unmanaged view with a right layout.
+ */
+template <typename Pointer, typename... ExtentsType,
+          std::enable_if_t<std::is_pointer_v<Pointer>, int> = 0>
+auto wrap(Pointer const data, ExtentsType const... extents) {
+  using Pointee = std::remove_pointer_t<Pointer>;
+  static_assert(sizeof...(extents) > 0,
+                "At least the left-most extent must be given");
+  static_assert(!std::is_array_v<Pointee> || std::extent_v<Pointee> > 0,
+                "Pointed arrays must have known bounds");
+
+  using View = raw_view_t<
+      typename kokkos_addendum::add_pointers<Pointee,
+                                             sizeof...(extents)>::type>;
+
+  return WrapperArray<View>(
+      View(reinterpret_cast<std::remove_all_extents_t<Pointee> *>(data),
+           static_cast<std::size_t>(extents)...));
+}
+
+/**
+ * Create an array wrapper around a pointer to raw storage in column-major
+ * order, as a Fortran array, without copy nor allocation.
+ * The brackets follow the order of the Fortran dimensions, starting from 0.
+ * @tparam ValueType Type of the elements (automatically deduced).
+ * @tparam ExtentsType Type of the extents (automatically deduced).
+ * @param tag Column-major tag, `brak::column_major`.
+ * @param data Pointer to the first element. It must outlive the wrapper.
+ * @param extents Pack of extents, from the left-most dimension, which is the
+ * contiguous one.
+ * @return Array wrapper of an unmanaged view with a left layout.
+ */
+template <typename ValueType, typename... ExtentsType>
+auto wrap([[maybe_unused]] ColumnMajor const tag, ValueType *const data,
+          ExtentsType const... extents) {
+  static_assert(!std::is_array_v<ValueType>,
+                "Column-major storage must be wrapped from a pointer to its "
+                "elements");
+  static_assert(sizeof...(extents) > 0, "At least one extent must be given");
+
+  using View = raw_view_t<
+      typename kokkos_addendum::add_pointers<ValueType,
+                                             sizeof...(extents)>::type,
+      Kokkos::LayoutLeft>;
+
+  return WrapperArray<View>(
+      View(data, static_cast<std::size_t>(extents)...));
+}
+
+} // namespace brak
+
+#endif // ifndef __BRAK_WRAP_HPP__
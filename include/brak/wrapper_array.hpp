@@ -1,12 +1,17 @@
 #ifndef __BRAK_WRAPPER_ARRAY_HPP__
 #define __BRAK_WRAPPER_ARRAY_HPP__
 
+#include <string>
 #include <type_traits>
 #include <utility>
 
 #include <Kokkos_Core.hpp>
 
+#include "brak/bounds_check.hpp"
 #include "brak/kokkos_view.hpp"
+#include "brak/profiling.hpp"
+#include "brak/strided_iterator.hpp"
+#include "brak/wrapper_range.hpp"
 
 namespace brak {
 
@@ -14,23 +19,36 @@ namespace brak {
  * Wrapper based on an array of indices.
  * @tparam View Type of the input view.
  * @tparam depth Current depth of the wrapper.
+ * @tparam IndexType Type of the stored and forwarded indices. Defaults to the
+ * size type of the view, a narrower type like `std::int32_t` can be used when
+ * the extents of the view fit in it.
+ * @tparam Tiles Extents of the tiles, as `kokkos_addendum::tile_extents`, if
+ * the view is a tiled view created with `kokkos_addendum::make_tiled`. The
+ * wrapper then has half the rank of the view, and each index is split into
+ * the index of a tile and the index in the tile.
  */
-template <typename View, std::size_t depth = 0> class WrapperArray {
+template <typename View, std::size_t depth = 0,
+          typename IndexType = typename View::size_type,
+          typename Tiles = kokkos_addendum::tile_extents<>>
+class WrapperArray {
   /**
    * Marker to identify the class.
    */
-  using WrapperArrayType = WrapperArray<View, depth>;
+  using WrapperArrayType = WrapperArray<View, depth, IndexType, Tiles>;
 
   /**
    * Wrapped view.
    */
   View mData;
   static_assert(Kokkos::is_view<View>::value);
+  static_assert(std::is_integral_v<IndexType>, "Index type must be integral");
+  static_assert(Tiles::rank == 0 || View::rank() == 2 * Tiles::rank,
+                "Tiled view must have twice the rank of the tiles");
 
   /**
    * Array of the indices.
    */
-  Kokkos::Array<std::size_t, depth> mIndices;
+  Kokkos::Array<IndexType, depth> mIndices;
 
 public:
   /**
@@ -47,7 +65,7 @@ public:
    */
   KOKKOS_FUNCTION
   WrapperArray(View const data,
-               Kokkos::Array<std::size_t, depth> const &indices)
+               Kokkos::Array<IndexType, depth> const &indices)
       : mData(data), mIndices(indices) {}
 
   /**
@@ -55,25 +73,30 @@ public:
    * @return Rank of the wrapper.
    */
   KOKKOS_FUNCTION
-  static std::size_t constexpr getRank() { return View::rank() - depth; }
+  static std::size_t constexpr getRank() { return getRankSource() - depth; }
 
   /**
-   * Get the rank of the wrapped view.
+   * Get the rank of the wrapped view, or of the tiles of a tiled view.
    * @return Rank of the wrapped view.
    */
   KOKKOS_FUNCTION
-  static std::size_t constexpr getRankSource() { return View::rank(); }
+  static std::size_t constexpr getRankSource() {
+    return View::rank() - Tiles::rank;
+  }
 
   /**
    * Create a sub-wrapper with a rank lowered by 1.
    * @param index Left-most index to extract from the wrapped view.
    * @return A sub-wrapper or a reference to a scalar if the current wrapper
-   * has a dimension of 1.
+   * has a dimension of 1. The reference is an atomic proxy if the wrapped
+   * view is atomic.
    */
   KOKKOS_FUNCTION
-  constexpr decltype(auto) operator[](std::size_t const index) const {
+  constexpr decltype(auto) operator[](IndexType const index) const {
     // recreate array of indices
-    Kokkos::Array<std::size_t, depth + 1> indices = extendIndices(index);
+    Kokkos::Array<IndexType, depth + 1> indices = extendIndices(index);
+    BRAK_CHECK_BOUNDS(mData, getStorageIndices(indices));
+    BRAK_PROFILE_INDICES(mData, depth, getStorageIndices(indices));
 
     if constexpr (getRank() > 1) {
       // return wrapper of the view with a new array of indices
@@ -85,31 +108,56 @@ public:
       // each successive wrapper retrieved, which greatly improves performance.
       // On GPU, reference counting of views is already disabled by default.
 
-      return WrapperArray<ViewNext, depth + 1>(mData, indices);
+      return WrapperArray<ViewNext, depth + 1, IndexType, Tiles>(mData,
+                                                                 indices);
     } else {
       // return a reference to a scalar
       return getValue(indices);
     }
   }
 
+  /**
+   * Create a range wrapper, whose left-most dimension is sliced by a range.
+   * @param range Range of indices of the left-most dimension, created with
+   * `brak::range`.
+   * @return Range wrapper of the same rank, accessing the wrapped view
+   * through an offset and a step per dimension, without creating any
+   * subview.
+   */
+  KOKKOS_FUNCTION
+  auto operator[](Range const &range) const {
+    static_assert(Tiles::rank == 0,
+                  "Ranges are not available for a tiled wrapper");
+
+    // make the view unmanaged, as for a sub-wrapper
+    using ViewNext =
+        std::conditional_t<View::traits::memory_traits::is_unmanaged, View,
+                           kokkos_addendum::make_unmanaged<View>>;
+
+    return WrapperRange<ViewNext, depth, IndexType>(mData, mIndices)[range];
+  }
+
   /**
    * Directly access to a scalar value.
    * @tparam IndicesType Type of the indices. They will be casted to
-   * `std::size_t`.
+   * `IndexType`.
    * @param indices Pack of indices. The number of indices must match the rank
    * of the current wrapper.
-   * @return Reference to a scalar of the view at the given indices.
+   * @return Reference to a scalar of the view at the given indices, or atomic
+   * proxy if the wrapped view is atomic.
    */
   template <typename... IndicesType>
-  KOKKOS_FUNCTION constexpr auto &
+  KOKKOS_FUNCTION constexpr decltype(auto)
   operator()(IndicesType const... indices) const {
     static_assert(sizeof...(indices) == getRank(), "Rank mismatch");
 
     // merge the two arrays of indices
-    Kokkos::Array<std::size_t, getRankSource()> indicesJoined =
-        extendIndices(static_cast<std::size_t>(indices)...);
-    // NOTE The indices are converted to `std::size_t` as it seems not possible
+    Kokkos::Array<IndexType, getRankSource()> indicesJoined =
+        extendIndices(static_cast<IndexType>(indices)...);
+    // NOTE The indices are converted to `IndexType` as it seems not possible
     // to easily obtain a parameter pack of the same type.
+    BRAK_CHECK_BOUNDS(mData, getStorageIndices(indicesJoined));
+    BRAK_PROFILE_INDICES(mData, depth, getStorageIndices(indicesJoined));
 
     // return reference to scalar
     return getValue(indicesJoined);
@@ -122,14 +170,154 @@ public:
    * memory and lead to unpredictable behaviors.
    */
   KOKKOS_FUNCTION
-  typename View::value_type *operator*() { return mData.data(); }
+  typename View::value_type *operator*() {
+    BRAK_PROFILE_ESCAPE(mData);
+
+    return mData.data();
+  }
 
   /**
    * Retrieve the wrapped view.
-   * @return Copy of the wrapped view.
+   * @return Copy of the wrapped view. For a tiled wrapper, this is the tiled
+   * view.
+   */
+  KOKKOS_FUNCTION
+  View getView() const {
+    BRAK_PROFILE_ESCAPE(mData);
+
+    return mData;
+  }
+
+  /**
+   * Create a wrapper of the same indices whose accesses are atomic.
+   * The wrapped view is recreated with the atomic memory trait, so that the
+   * accesses return atomic proxies, which can be used for concurrent
+   * accumulations.
+   * @return Atomic wrapper.
+   */
+  KOKKOS_FUNCTION
+  auto atomic() const {
+    using ViewAtomic = kokkos_addendum::make_unmanaged_atomic<View>;
+
+    return WrapperArray<ViewAtomic, depth, IndexType, Tiles>(
+        ViewAtomic(mData), mIndices);
+  }
+
+  /**
+   * Create a wrapper of the same indices whose accesses are read-only.
+   * The wrapped view is recreated with constant data and the random access
+   * memory trait, so that the accesses return constant references, which can
+   * be loaded through read-only caches on GPU.
+   * @return Read-only wrapper.
+   */
+  KOKKOS_FUNCTION
+  auto readonly() const {
+    using ViewReadonly = kokkos_addendum::make_unmanaged_readonly<View>;
+
+    return WrapperArray<ViewReadonly, depth, IndexType, Tiles>(
+        ViewReadonly(mData), mIndices);
+  }
+
+  /**
+   * Create a wrapper of the same indices whose accesses are not aliased.
+   * The wrapped view is recreated with the restrict memory trait, which is
+   * kept by the sub-wrappers, so that the compiler can assume that the
+   * accesses do not alias the accesses to any other view, as for
+   * vectorization.
+   * @return Restrict wrapper.
+   * @note The data must not be accessed through any other view or wrapper in
+   * the same kernel, otherwise the behavior is undefined.
+   */
+  KOKKOS_FUNCTION
+  auto restrict() const {
+    using ViewRestrict = kokkos_addendum::make_unmanaged_restrict<View>;
+
+    return WrapperArray<ViewRestrict, depth, IndexType, Tiles>(
+        ViewRestrict(mData), mIndices);
+  }
+
+  /**
+   * Get the extent of a dimension of the wrapper.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Extent of the dimension.
    */
   KOKKOS_FUNCTION
-  View getView() { return mData; }
+  std::size_t getExtent(std::size_t const dimension) const {
+    if constexpr (Tiles::rank == 0) {
+      return mData.extent(depth + dimension);
+    } else {
+      // the view contains whole tiles
+      return mData.extent(depth + dimension) *
+             Tiles::extent(depth + dimension);
+    }
+  }
+
+  /**
+   * Get the stride of a dimension of the wrapper.
+   * @tparam tilesRank Rank of the tiles. It is a template parameter, so that
+   * the method is not available for a tiled wrapper, whose elements are not
+   * separated by a constant stride across the tiles.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Stride of the dimension, in number of elements.
+   */
+  template <std::size_t tilesRank = Tiles::rank,
+            std::enable_if_t<tilesRank == 0, int> = 0>
+  KOKKOS_FUNCTION std::size_t getStride(std::size_t const dimension) const {
+    return mData.stride(depth + dimension);
+  }
+
+  /**
+   * Get the number of elements of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Number of elements.
+   */
+  template <std::size_t rank = View::rank() - Tiles::rank - depth>
+  KOKKOS_FUNCTION std::size_t size() const {
+    static_assert(rank == 1, "Size is only available for a rank of 1");
+
+    return getExtent(0);
+  }
+
+  /**
+   * Get an iterator to the first element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Raw pointer if the elements are known at compile time to be
+   * contiguous, strided iterator otherwise.
+   */
+  template <std::size_t rank = View::rank() - Tiles::rank - depth>
+  KOKKOS_FUNCTION auto begin() const {
+    static_assert(rank == 1, "Iterators are only available for a rank of 1");
+    static_assert(Tiles::rank == 0,
+                  "Iterators are not available for a tiled wrapper");
+
+    typename View::value_type *const pointer =
+        &getValue(extendIndices(IndexType(0)));
+
+    if constexpr (kokkos_addendum::has_unit_stride<View, getRankSource() - 1>) {
+      // return a raw pointer, which is the best for vectorization
+      return pointer;
+    } else {
+      // return an iterator that jumps over the stride
+      return StridedIterator<typename View::value_type>(
+          pointer, static_cast<std::ptrdiff_t>(getStride(0)));
+    }
+  }
+
+  /**
+   * Get an iterator past the last element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Raw pointer if the elements are known at compile time to be
+   * contiguous, strided iterator otherwise.
+   */
+  template <std::size_t rank = View::rank() - Tiles::rank - depth>
+  KOKKOS_FUNCTION auto end() const {
+    return begin<rank>() + static_cast<std::ptrdiff_t>(size<rank>());
+  }
 
 private:
   /**
@@ -138,8 +326,8 @@ private:
    * @return Extended array of indices.
    */
   KOKKOS_FUNCTION
-  constexpr Kokkos::Array<std::size_t, depth + 1>
-  extendIndices(std::size_t const index) const {
+  constexpr Kokkos::Array<IndexType, depth + 1>
+  extendIndices(IndexType const index) const {
     return extendIndices(std::make_index_sequence<depth>(), index);
   }
 
@@ -150,7 +338,7 @@ private:
    * @return Extended array of indices.
    */
   template <typename... IndicesType>
-  KOKKOS_FUNCTION constexpr Kokkos::Array<std::size_t, getRankSource()>
+  KOKKOS_FUNCTION constexpr Kokkos::Array<IndexType, getRankSource()>
   extendIndices(IndicesType const... indices) const {
     return extendIndices(std::make_index_sequence<depth>(), indices...);
   }
@@ -164,9 +352,9 @@ private:
    * @return Extended array of indices.
    */
   template <std::size_t... indexSequence>
-  KOKKOS_FUNCTION constexpr Kokkos::Array<std::size_t, depth + 1> extendIndices(
+  KOKKOS_FUNCTION constexpr Kokkos::Array<IndexType, depth + 1> extendIndices(
       [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg,
-      std::size_t const index) const {
+      IndexType const index) const {
     return {{mIndices[indexSequence]..., index}};
   }
 
@@ -180,7 +368,7 @@ private:
    * @return Extended array of indices.
    */
   template <std::size_t... indexSequence, typename... IndicesType>
-  KOKKOS_FUNCTION constexpr Kokkos::Array<std::size_t, getRankSource()>
+  KOKKOS_FUNCTION constexpr Kokkos::Array<IndexType, getRankSource()>
   extendIndices(
       [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg,
       IndicesType const... indices) const {
@@ -193,14 +381,16 @@ private:
    * @return Scalar value of the view.
    */
   template <std::size_t depthNext>
-  KOKKOS_FUNCTION constexpr auto &
-  getValue(Kokkos::Array<std::size_t, depthNext> const &indices) const {
+  KOKKOS_FUNCTION constexpr decltype(auto)
+  getValue(Kokkos::Array<IndexType, depthNext> const &indices) const {
     return getValue(indices, std::make_index_sequence<depthNext>());
   }
 
   /**
    * Get the scalar value of the wrapped view from a array of indices and an
    * index sequence.
+   * If the wrapped view has static extents, the view mapping folds their
+   * strides at compile time.
    * @tparam indexSequence Index sequence (automatically deduced).
    * @param indices Array of indices above the sub-wrapper.
    * @param indexSequenceArg Index sequence of the indices from 0 to `depth` to
@@ -208,14 +398,169 @@ private:
    * @return Scalar value of the view.
    */
   template <std::size_t depthNext, std::size_t... indexSequence>
-  KOKKOS_FUNCTION constexpr auto &
-  getValue(Kokkos::Array<std::size_t, depthNext> const &indices,
+  KOKKOS_FUNCTION constexpr decltype(auto)
+  getValue(Kokkos::Array<IndexType, depthNext> const &indices,
            [[maybe_unused]] std::index_sequence<indexSequence...>
                indexSequenceArg) const {
-    return mData(indices[indexSequence]...);
+    if constexpr (Tiles::rank == 0) {
+      return mData(indices[indexSequence]...);
+    } else {
+      // NOTE The extents of the tiles are constant expressions, so that the
+      // divisions and the modulos are simplified at compile time, into shifts
+      // and masks for powers of 2.
+      return mData(indices[indexSequence] /
+                       static_cast<IndexType>(
+                           std::integral_constant<
+                               std::size_t,
+                               Tiles::extent(indexSequence)>::value)...,
+                   indices[indexSequence] %
+                       static_cast<IndexType>(
+                           std::integral_constant<
+                               std::size_t,
+                               Tiles::extent(indexSequence)>::value)...);
+    }
+  }
+
+  /**
+   * Get the indices of the wrapped view from an array of indices, for bounds
+   * checking and profiling.
+   * @tparam size Number of indices (automatically deduced).
+   * @param indices Array of indices above the sub-wrapper.
+   * @return Same indices if the wrapper is not tiled. Otherwise, indices of
+   * the tile, followed by the indices in the tile if all the indices are
+   * given.
+   */
+  template <std::size_t size>
+  KOKKOS_FUNCTION constexpr auto
+  getStorageIndices(Kokkos::Array<IndexType, size> const &indices) const {
+    if constexpr (Tiles::rank == 0) {
+      return indices;
+    } else {
+      return getStorageIndices(indices, std::make_index_sequence<size>());
+    }
+  }
+
+  /**
+   * Get the indices of the tiled view from an array of indices and an index
+   * sequence.
+   * @tparam size Number of indices (automatically deduced).
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @param indices Array of indices above the sub-wrapper.
+   * @param indexSequenceArg Index sequence of the indices from 0 to `size` to
+   * access `indices`.
+   * @return Indices of the tile, followed by the indices in the tile if all
+   * the indices are given.
+   */
+  template <std::size_t size, std::size_t... indexSequence>
+  KOKKOS_FUNCTION constexpr auto getStorageIndices(
+      Kokkos::Array<IndexType, size> const &indices,
+      [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg)
+      const {
+    // NOTE A partial access only checks and records the indices of the tile,
+    // which are the left-most dimensions of the tiled view.
+    if constexpr (size == getRankSource()) {
+      return Kokkos::Array<IndexType, 2 * size>{
+          {static_cast<IndexType>(indices[indexSequence] /
+                                  Tiles::extent(indexSequence))...,
+           static_cast<IndexType>(indices[indexSequence] %
+                                  Tiles::extent(indexSequence))...}};
+    } else {
+      return Kokkos::Array<IndexType, size>{
+          {static_cast<IndexType>(indices[indexSequence] /
+                                  Tiles::extent(indexSequence))...}};
+    }
   }
 };
 
+/**
+ * Create an array wrapper from a view.
+ * If static extents are given, the view is first reinterpreted with its
+ * right-most extents known at compile time, so that inner bracket chains
+ * turn into constant offsets.
+ * @tparam staticExtents Right-most extents of the view known at compile time.
+ * @tparam View Type of the input view (automatically deduced).
+ * @param data Input view. If static extents are given, it must be contiguous,
+ * and have a right or left layout.
+ * @return Array wrapper of the view.
+ */
+template <std::size_t... staticExtents, typename View>
+auto make_wrapper(View const data) {
+  if constexpr (sizeof...(staticExtents) == 0) {
+    return WrapperArray<View>(data);
+  } else {
+    auto dataStatic =
+        kokkos_addendum::create_unmanaged_static_extents<staticExtents...>(
+            data);
+
+    return WrapperArray<decltype(dataStatic)>(dataStatic);
+  }
+}
+
+/**
+ * Create an array wrapper from a view, with brackets mapped onto the
+ * dimensions of the view in reverse order.
+ * The first bracket indexes the right-most dimension of the view, and the
+ * last bracket its left-most one. For a view with a left layout, loop nests
+ * with the last bracket innermost then walk the memory contiguously.
+ * @tparam View Type of the input view (automatically deduced).
+ * @param data Input view. It must not have static extents, and must be
+ * contiguous if it has a right or left layout.
+ * @return Array wrapper of the view with reversed dimensions.
+ * @note The wrapped view, retrieved with `getView`, is an unmanaged view with
+ * reversed dimensions.
+ */
+template <typename View> auto make_wrapper_reversed(View const data) {
+  auto dataReversed = kokkos_addendum::create_unmanaged_reversed(data);
+
+  return WrapperArray<decltype(dataReversed)>(dataReversed);
+}
+
+/**
+ * Type of a tiled array wrapper.
+ * @tparam View Type of the view to tile, without static extents.
+ * @tparam tileExtents Extents of a tile, from left to right.
+ */
+template <typename View, std::size_t... tileExtents>
+using wrapper_tiled_t =
+    WrapperArray<kokkos_addendum::make_tiled<View, tileExtents...>, 0,
+                 typename View::size_type,
+                 kokkos_addendum::tile_extents<tileExtents...>>;
+
+/**
+ * Allocate a tiled view and create an array wrapper of it.
+ * The data are stored by tiles, each tile being contiguous, which improves
+ * the locality of accesses to neighbours in all the dimensions, as for
+ * stencils. The wrapper is accessed as a wrapper of a view of the given
+ * extents.
+ * @tparam View Type of the view to tile, without static extents.
+ * @tparam tileExtents Extents of a tile, from left to right. Powers of 2
+ * allow cheaper accesses.
+ * @tparam ExtentsType Type of the extents (automatically deduced).
+ * @param label Label of the tiled view.
+ * @param extents Pack of extents of the wrapper. Each extent must be a
+ * multiple of the extent of a tile.
+ * @return Tiled array wrapper.
+ */
+template <typename View, std::size_t... tileExtents, typename... ExtentsType>
+wrapper_tiled_t<View, tileExtents...>
+create_wrapper_tiled(std::string const &label,
+                     ExtentsType const... extents) {
+  static_assert(View::rank_dynamic() == View::rank(),
+                "View to tile must not have static extents");
+  static_assert(sizeof...(tileExtents) == View::rank(),
+                "An extent of tile must be given for each dimension");
+  static_assert(sizeof...(extents) == View::rank(), "Rank mismatch");
+
+  if (!(((static_cast<std::size_t>(extents) % tileExtents) == 0) && ...)) {
+    Kokkos::abort("Extents must be multiples of the extents of a tile");
+  }
+
+  using ViewTiled = kokkos_addendum::make_tiled<View, tileExtents...>;
+
+  return wrapper_tiled_t<View, tileExtents...>(
+      ViewTiled(label, static_cast<std::size_t>(extents) / tileExtents...));
+}
+
 } // namespace brak
 
 #endif // ifndef __BRAK_WRAPPER_ARRAY_HPP__
@@ -0,0 +1,240 @@
+#ifndef __BRAK_WRAPPER_OFFSET_HPP__
+#define __BRAK_WRAPPER_OFFSET_HPP__
+
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/kokkos_view.hpp"
+#include "brak/strided_iterator.hpp"
+
+namespace brak {
+
+/**
+ * Wrapper based on a linear offset.
+ * @tparam View Type of the input view.
+ * @tparam depth Current depth of the wrapper.
+ */
+template <typename View, std::size_t depth = 0> class WrapperOffset {
+  /**
+   * Marker to identify the class.
+   */
+  using WrapperOffsetType = WrapperOffset<View, depth>;
+
+  /**
+   * Wrapped view.
+   */
+  View mData;
+  static_assert(Kokkos::is_view<View>::value);
+  // NOTE The accesses go through the raw pointer of the view, which would
+  // silently drop any memory trait other than unmanaged.
+  static_assert(!View::traits::memory_traits::is_atomic &&
+                    !View::traits::memory_traits::is_random_access &&
+                    !View::traits::memory_traits::is_restrict &&
+                    !View::traits::memory_traits::is_aligned,
+                "Memory traits other than unmanaged are not available for an "
+                "offset wrapper");
+
+  /**
+   * Linear offset of the sub-wrapper in the wrapped view, accumulated from
+   * the indices above it.
+   */
+  std::size_t mOffset;
+
+public:
+  /**
+   * Construct a wrapper from a view.
+   * @param data Input view.
+   */
+  KOKKOS_FUNCTION
+  explicit WrapperOffset(View const data) : mData(data), mOffset(0) {}
+
+  /**
+   * Construct a sub-wrapper from a view and a linear offset.
+   * @param data Input view.
+   * @param offset Linear offset of the sub-wrapper in the view.
+   */
+  KOKKOS_FUNCTION
+  WrapperOffset(View const data, std::size_t const offset)
+      : mData(data), mOffset(offset) {}
+
+  /**
+   * Get the current rank of the wrapper.
+   * @return Rank of the wrapper.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return View::rank() - depth; }
+
+  /**
+   * Get the rank of the wrapped view.
+   * @return Rank of the wrapped view.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRankSource() { return View::rank(); }
+
+  /**
+   * Create a sub-wrapper with a rank lowered by 1.
+   * @param index Left-most index to extract from the wrapped view.
+   * @return A sub-wrapper or a reference to a scalar if the current wrapper
+   * has a dimension of 1.
+   */
+  KOKKOS_FUNCTION
+  constexpr decltype(auto) operator[](std::size_t const index) const {
+    // accumulate the offset of the current dimension
+    std::size_t const offset = mOffset + index * mData.stride(depth);
+
+    if constexpr (getRank() > 1) {
+      // return wrapper of the view with a new offset
+      // make the view unmanaged at its first access
+      using ViewNext =
+          std::conditional_t<View::traits::memory_traits::is_unmanaged, View,
+                             kokkos_addendum::make_unmanaged<View>>;
+      // NOTE This disables reference counting on CPU for each view created in
+      // each successive wrapper retrieved, which greatly improves performance.
+      // On GPU, reference counting of views is already disabled by default.
+
+      return WrapperOffset<ViewNext, depth + 1>(mData, offset);
+    } else {
+      // return a reference to a scalar
+      return getValue(offset);
+    }
+  }
+
+  /**
+   * Directly access to a scalar value.
+   * @tparam IndicesType Type of the indices. They will be casted to
+   * `std::size_t`.
+   * @param indices Pack of indices. The number of indices must match the rank
+   * of the current wrapper.
+   * @return Reference to a scalar of the view at the given indices.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION constexpr auto &
+  operator()(IndicesType const... indices) const {
+    static_assert(sizeof...(indices) == getRank(), "Rank mismatch");
+
+    // return reference to scalar
+    return getValue(
+        extendOffset(std::make_index_sequence<sizeof...(indices)>(),
+                     static_cast<std::size_t>(indices)...));
+  }
+
+  /**
+   * Defer the wrapper to the pointer data in the wrapped view.
+   * @return Raw pointer to the wrapped data, shifted by the offset of the
+   * sub-wrapper.
+   * @note This method may give access to data that are not contiguous in
+   * memory and lead to unpredictable behaviors.
+   */
+  KOKKOS_FUNCTION
+  typename View::value_type *operator*() { return mData.data() + mOffset; }
+
+  /**
+   * Retrieve the wrapped view.
+   * @return Copy of the wrapped view.
+   */
+  KOKKOS_FUNCTION
+  View getView() const { return mData; }
+
+  /**
+   * Get the extent of a dimension of the wrapper.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Extent of the dimension.
+   */
+  KOKKOS_FUNCTION
+  std::size_t getExtent(std::size_t const dimension) const {
+    return mData.extent(depth + dimension);
+  }
+
+  /**
+   * Get the stride of a dimension of the wrapper.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Stride of the dimension, in number of elements.
+   */
+  KOKKOS_FUNCTION
+  std::size_t getStride(std::size_t const dimension) const {
+    return mData.stride(depth + dimension);
+  }
+
+  /**
+   * Get the number of elements of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Number of elements.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION std::size_t size() const {
+    static_assert(rank == 1, "Size is only available for a rank of 1");
+
+    return getExtent(0);
+  }
+
+  /**
+   * Get an iterator to the first element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Raw pointer if the elements are known at compile time to be
+   * contiguous, strided iterator otherwise.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION auto begin() const {
+    static_assert(rank == 1, "Iterators are only available for a rank of 1");
+
+    typename View::value_type *const pointer = mData.data() + mOffset;
+
+    if constexpr (kokkos_addendum::has_unit_stride<View, depth>) {
+      // return a raw pointer, which is the best for vectorization
+      return pointer;
+    } else {
+      // return an iterator that jumps over the stride
+      return StridedIterator<typename View::value_type>(
+          pointer, static_cast<std::ptrdiff_t>(getStride(0)));
+    }
+  }
+
+  /**
+   * Get an iterator past the last element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Raw pointer if the elements are known at compile time to be
+   * contiguous, strided iterator otherwise.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION auto end() const {
+    return begin<rank>() + static_cast<std::ptrdiff_t>(size<rank>());
+  }
+
+private:
+  /**
+   * Accumulate the offset of new indices and an index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @tparam IndicesType Type of the indices.
+   * @param indexSequenceArg Index sequence of the indices from 0 to the rank
+   * of the wrapper, to access the strides of the remaining dimensions.
+   * @param indices Pack of indices.
+   * @return Accumulated offset.
+   */
+  template <std::size_t... indexSequence, typename... IndicesType>
+  KOKKOS_FUNCTION constexpr std::size_t extendOffset(
+      [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg,
+      IndicesType const... indices) const {
+    return (mOffset + ... + (indices * mData.stride(depth + indexSequence)));
+  }
+
+  /**
+   * Get the scalar value of the wrapped view from a linear offset.
+   * @param offset Linear offset in the wrapped view.
+   * @return Scalar value of the view.
+   */
+  KOKKOS_FUNCTION
+  constexpr auto &getValue(std::size_t const offset) const {
+    return mData.data()[offset];
+  }
+};
+
+} // namespace brak
+
+#endif // ifndef __BRAK_WRAPPER_OFFSET_HPP__
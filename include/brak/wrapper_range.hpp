@@ -0,0 +1,389 @@
+#ifndef __BRAK_WRAPPER_RANGE_HPP__
+#define __BRAK_WRAPPER_RANGE_HPP__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "brak/bounds_check.hpp"
+#include "brak/profiling.hpp"
+#include "brak/strided_iterator.hpp"
+
+namespace brak {
+
+/**
+ * Range of indices of a dimension, to slice a wrapper with brackets.
+ */
+struct Range {
+  /**
+   * First index (included).
+   */
+  std::size_t mBegin;
+
+  /**
+   * Last index (excluded).
+   */
+  std::size_t mEnd;
+
+  /**
+   * Step between two indices.
+   */
+  std::size_t mStep;
+};
+
+/**
+ * Create a range of indices, to slice a wrapper as in `w[i][brak::range(lo,
+ * hi)]`.
+ * @param begin First index (included).
+ * @param end Last index (excluded).
+ * @param step Step between two indices, strictly positive.
+ * @return Range of indices.
+ */
+KOKKOS_FUNCTION
+constexpr Range range(std::size_t const begin, std::size_t const end,
+                      std::size_t const step = 1) {
+  return Range{begin, end, step};
+}
+
+/**
+ * Wrapper based on an array of indices, whose dimensions are sliced by
+ * ranges.
+ * Each dimension of the wrapped view has an offset and a step, which are
+ * applied to the indices given to the wrapper, so that an access costs the
+ * same as an access to an array wrapper, without creating any subview.
+ * @tparam View Type of the input view.
+ * @tparam depth Current depth of the wrapper.
+ * @tparam IndexType Type of the stored and forwarded indices.
+ */
+template <typename View, std::size_t depth = 0,
+          typename IndexType = typename View::size_type>
+class WrapperRange {
+  /**
+   * Marker to identify the class.
+   */
+  using WrapperRangeType = WrapperRange<View, depth, IndexType>;
+
+  /**
+   * Wrapped view.
+   */
+  View mData;
+  static_assert(Kokkos::is_view<View>::value);
+  static_assert(std::is_integral_v<IndexType>, "Index type must be integral");
+
+  /**
+   * Array of the indices of the wrapped view above the sub-wrapper.
+   */
+  Kokkos::Array<IndexType, depth> mIndices;
+
+  /**
+   * Array of the offsets of each dimension of the wrapped view.
+   */
+  Kokkos::Array<IndexType, View::rank()> mOffsets;
+
+  /**
+   * Array of the steps of each dimension of the wrapped view.
+   */
+  Kokkos::Array<IndexType, View::rank()> mSteps;
+
+  /**
+   * Array of the extents of each dimension of the wrapper.
+   */
+  Kokkos::Array<IndexType, View::rank()> mExtents;
+
+public:
+  /**
+   * Construct a wrapper of the whole extents of a view from an array of
+   * indices.
+   * @param data Input view.
+   * @param indices Array of indices above the sub-wrapper.
+   */
+  KOKKOS_FUNCTION
+  WrapperRange(View const data,
+               Kokkos::Array<IndexType, depth> const &indices)
+      : mData(data), mIndices(indices) {
+    for (std::size_t dimension = 0; dimension < View::rank(); dimension++) {
+      mOffsets[dimension] = 0;
+      mSteps[dimension] = 1;
+      mExtents[dimension] = static_cast<IndexType>(data.extent(dimension));
+    }
+  }
+
+  /**
+   * Construct a sub-wrapper from a view, an array of indices, and the
+   * slices of the dimensions.
+   * @param data Input view.
+   * @param indices Array of indices above the sub-wrapper.
+   * @param offsets Array of the offsets of each dimension.
+   * @param steps Array of the steps of each dimension.
+   * @param extents Array of the extents of each dimension.
+   */
+  KOKKOS_FUNCTION
+  WrapperRange(View const data,
+               Kokkos::Array<IndexType, depth> const &indices,
+               Kokkos::Array<IndexType, View::rank()> const &offsets,
+               Kokkos::Array<IndexType, View::rank()> const &steps,
+               Kokkos::Array<IndexType, View::rank()> const &extents)
+      : mData(data), mIndices(indices), mOffsets(offsets), mSteps(steps),
+        mExtents(extents) {}
+
+  /**
+   * Get the current rank of the wrapper.
+   * @return Rank of the wrapper.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return getRankSource() - depth; }
+
+  /**
+   * Get the rank of the wrapped view.
+   * @return Rank of the wrapped view.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRankSource() { return View::rank(); }
+
+  /**
+   * Create a sub-wrapper with a rank lowered by 1.
+   * @param index Left-most index in the range of the current dimension.
+   * @return A sub-wrapper or a reference to a scalar if the current wrapper
+   * has a dimension of 1.
+   */
+  KOKKOS_FUNCTION
+  constexpr decltype(auto) operator[](IndexType const index) const {
+    // check the index in the range, before it is mapped to the wrapped view
+    BRAK_CHECK_EXTENTS(mData, Kokkos::Array<IndexType, 1>{{index}},
+                       Kokkos::Array<IndexType, 1>{{mExtents[depth]}});
+
+    // recreate array of indices, in the wrapped view
+    Kokkos::Array<IndexType, depth + 1> indices =
+        extendIndices(std::make_index_sequence<depth>(), index);
+    BRAK_CHECK_BOUNDS(mData, indices);
+    BRAK_PROFILE_INDICES(mData, depth, indices);
+
+    if constexpr (getRank() > 1) {
+      // return wrapper of the view with a new array of indices
+      return WrapperRange<View, depth + 1, IndexType>(mData, indices, mOffsets,
+                                                      mSteps, mExtents);
+    } else {
+      // return a reference to a scalar
+      return getValue(indices, std::make_index_sequence<getRankSource()>());
+    }
+  }
+
+  /**
+   * Slice the left-most dimension of the wrapper by a range.
+   * The range applies to the indices of the current wrapper, so that ranges
+   * can be nested.
+   * The step of the range must be strictly positive, and its end must not
+   * exceed the extent of the dimension, which is checked with
+   * `BRAK_ENABLE_BOUNDS_CHECK`.
+   * @param range Range of indices of the left-most dimension.
+   * @return Wrapper of the same rank, whose left-most dimension is sliced.
+   */
+  KOKKOS_FUNCTION
+  WrapperRangeType operator[](Range const &range) const {
+    BRAK_CHECK_RANGE(mData, range.mBegin, range.mEnd, range.mStep,
+                     getExtent(0));
+
+    Kokkos::Array<IndexType, View::rank()> offsets = mOffsets;
+    Kokkos::Array<IndexType, View::rank()> steps = mSteps;
+    Kokkos::Array<IndexType, View::rank()> extents = mExtents;
+
+    // NOTE An empty range, or a range with an invalid step, keeps the
+    // offset and the step of the dimension, so that its stride stays valid.
+    if (range.mEnd <= range.mBegin || range.mStep == 0) {
+      extents[depth] = 0;
+
+      return WrapperRangeType(mData, mIndices, offsets, steps, extents);
+    }
+
+    offsets[depth] += static_cast<IndexType>(range.mBegin) * mSteps[depth];
+    steps[depth] *= static_cast<IndexType>(range.mStep);
+    extents[depth] = static_cast<IndexType>(
+        (range.mEnd - range.mBegin + range.mStep - 1) / range.mStep);
+
+    return WrapperRangeType(mData, mIndices, offsets, steps, extents);
+  }
+
+  /**
+   * Directly access to a scalar value.
+   * @tparam IndicesType Type of the indices. They will be casted to
+   * `IndexType`.
+   * @param indices Pack of indices, in the ranges of the dimensions. The
+   * number of indices must match the rank of the current wrapper.
+   * @return Reference to a scalar of the view at the given indices.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION constexpr decltype(auto)
+  operator()(IndicesType const... indices) const {
+    static_assert(sizeof...(indices) == getRank(), "Rank mismatch");
+
+    // check the indices in the ranges, before they are mapped to the wrapped
+    // view
+    BRAK_CHECK_EXTENTS(mData,
+                       Kokkos::Array<IndexType, getRank()>{
+                           {static_cast<IndexType>(indices)...}},
+                       getExtents(std::make_index_sequence<getRank()>()));
+
+    // merge the two arrays of indices
+    Kokkos::Array<IndexType, getRankSource()> indicesJoined =
+        extendIndices(std::make_index_sequence<depth>(),
+                      static_cast<IndexType>(indices)...);
+    BRAK_CHECK_BOUNDS(mData, indicesJoined);
+    BRAK_PROFILE_INDICES(mData, depth, indicesJoined);
+
+    // return reference to scalar
+    return getValue(indicesJoined,
+                    std::make_index_sequence<getRankSource()>());
+  }
+
+  /**
+   * Retrieve the wrapped view.
+   * @return Copy of the whole wrapped view, regardless of the ranges.
+   */
+  KOKKOS_FUNCTION
+  View getView() const {
+    BRAK_PROFILE_ESCAPE(mData);
+
+    return mData;
+  }
+
+  /**
+   * Get the extent of a dimension of the wrapper.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Number of indices in the range of the dimension.
+   */
+  KOKKOS_FUNCTION
+  std::size_t getExtent(std::size_t const dimension) const {
+    return mExtents[depth + dimension];
+  }
+
+  /**
+   * Get the stride of a dimension of the wrapper.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Stride of the dimension, in number of elements, including the
+   * step of its range.
+   */
+  KOKKOS_FUNCTION
+  std::size_t getStride(std::size_t const dimension) const {
+    return mData.stride(depth + dimension) * mSteps[depth + dimension];
+  }
+
+  /**
+   * Get the number of elements of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Number of elements.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION std::size_t size() const {
+    static_assert(rank == 1, "Size is only available for a rank of 1");
+
+    return getExtent(0);
+  }
+
+  /**
+   * Get an iterator to the first element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Strided iterator, as the step of the range is only known at
+   * runtime. It is an empty iterator if the range is empty, as there is no
+   * element to point to.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION auto begin() const {
+    static_assert(rank == 1, "Iterators are only available for a rank of 1");
+
+    if (size<rank>() == 0) {
+      return StridedIterator<typename View::value_type>();
+    }
+
+    typename View::value_type *const pointer =
+        &getValue(extendIndices(std::make_index_sequence<depth>(),
+                                IndexType(0)),
+                  std::make_index_sequence<getRankSource()>());
+
+    return StridedIterator<typename View::value_type>(
+        pointer, static_cast<std::ptrdiff_t>(getStride(0)));
+  }
+
+  /**
+   * Get an iterator past the last element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Strided iterator.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION auto end() const {
+    return begin<rank>() + static_cast<std::ptrdiff_t>(size<rank>());
+  }
+
+private:
+  /**
+   * Recreate an array of indices of the wrapped view with new indices and an
+   * index sequence.
+   * The new indices are mapped through the offsets and the steps of their
+   * dimensions.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @tparam IndicesType Type of the indices.
+   * @param indexSequenceArg Index sequence of the indices from 0 to `depth` to
+   * access `mIndices`.
+   * @param indices Pack of indices, in the ranges of the dimensions.
+   * @return Extended array of indices.
+   */
+  template <std::size_t... indexSequence, typename... IndicesType>
+  KOKKOS_FUNCTION constexpr Kokkos::Array<IndexType,
+                                         depth + sizeof...(IndicesType)>
+  extendIndices(
+      [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg,
+      IndicesType const... indices) const {
+    Kokkos::Array<IndexType, depth + sizeof...(IndicesType)> indicesExtended{
+        {mIndices[indexSequence]..., static_cast<IndexType>(indices)...}};
+
+    // map the new indices to the indices of the wrapped view
+    for (std::size_t dimension = depth;
+         dimension < depth + sizeof...(IndicesType); dimension++) {
+      indicesExtended[dimension] =
+          mOffsets[dimension] + indicesExtended[dimension] * mSteps[dimension];
+    }
+
+    return indicesExtended;
+  }
+
+  /**
+   * Get the extents of the dimensions of the wrapper with an index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @param indexSequenceArg Index sequence of the dimensions from 0 to the
+   * rank of the wrapper.
+   * @return Array of the extents of the dimensions of the wrapper.
+   */
+  template <std::size_t... indexSequence>
+  KOKKOS_FUNCTION constexpr Kokkos::Array<IndexType, sizeof...(indexSequence)>
+  getExtents([[maybe_unused]] std::index_sequence<indexSequence...>
+                 indexSequenceArg) const {
+    return {{mExtents[depth + indexSequence]...}};
+  }
+
+  /**
+   * Get the scalar value of the wrapped view from an array of indices and an
+   * index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @param indices Array of indices of all the dimensions of the view.
+   * @param indexSequenceArg Index sequence of the indices from 0 to the rank
+   * of the view to access `indices`.
+   * @return Scalar value of the view.
+   */
+  template <std::size_t... indexSequence>
+  KOKKOS_FUNCTION constexpr decltype(auto)
+  getValue(Kokkos::Array<IndexType, getRankSource()> const &indices,
+           [[maybe_unused]] std::index_sequence<indexSequence...>
+               indexSequenceArg) const {
+    return mData(indices[indexSequence]...);
+  }
+};
+
+} // namespace brak
+
+#endif // ifndef __BRAK_WRAPPER_RANGE_HPP__
@@ -2,30 +2,46 @@
 #define __BRAK_WRAPPER_SUBVIEW_HPP__
 
 #include <type_traits>
+#include <utility>
 
 #include <Kokkos_Core.hpp>
 
+#include "bounds_check.hpp"
 #include "kokkos_view.hpp"
+#include "profiling.hpp"
+#include "strided_iterator.hpp"
 
 namespace brak {
 
 /**
  * Wrapper based on subviews.
+ * The subviews are lazily materialized: a sub-wrapper stores the wrapped view
+ * and the indices above it, and only creates a subview when it is retrieved.
  * @tparam View Type of the input view.
+ * @tparam depth Current depth of the wrapper.
  */
-template <typename View> class WrapperSubview {
+template <typename View, std::size_t depth = 0> class WrapperSubview {
   /**
    * Marker to identify the class.
    */
-  using WrapperSubviewType = WrapperSubview<View>;
+  using WrapperSubviewType = WrapperSubview<View, depth>;
+
+  /**
+   * Type of the materialized subview.
+   */
+  using Subview = typename kokkos_addendum::subview_left<View, depth>::type;
 
   /**
    * Wrapped view.
-   * We use the fact that a subview is actually a view.
    */
   View mData;
   static_assert(Kokkos::is_view<View>::value);
 
+  /**
+   * Array of the pending indices of the subview.
+   */
+  Kokkos::Array<std::size_t, depth> mIndices;
+
 public:
   /**
    * Construct a wrapper from a view.
@@ -34,42 +50,60 @@ public:
   KOKKOS_FUNCTION
   explicit WrapperSubview(View const data) : mData(data) {}
 
+  /**
+   * Construct a sub-wrapper from a view and an array of pending indices.
+   * @param data Input view.
+   * @param indices Array of indices above the sub-wrapper.
+   */
+  KOKKOS_FUNCTION
+  WrapperSubview(View const data,
+                 Kokkos::Array<std::size_t, depth> const &indices)
+      : mData(data), mIndices(indices) {}
+
+  /**
+   * Get the current rank of the wrapper.
+   * @return Rank of the wrapper.
+   */
+  KOKKOS_FUNCTION
+  static std::size_t constexpr getRank() { return View::rank() - depth; }
+
   /**
    * Get the rank of the wrapped view.
    * @return Rank of the wrapped view.
    */
   KOKKOS_FUNCTION
-  static std::size_t constexpr getRank() { return View::rank(); }
+  static std::size_t constexpr getRankSource() { return View::rank(); }
 
   /**
    * Create a wrapped subview with a rank lowered by 1.
+   * The subview is not materialized until it is retrieved.
    * @param index Left-most index to extract from the wrapped view.
    * @return A wrapped subview or a reference to a scalar if the wrapped view
-   * has a dimension of 1.
+   * has a dimension of 1. The reference is an atomic proxy if the wrapped
+   * view is atomic.
    */
   KOKKOS_FUNCTION
   decltype(auto) operator[](std::size_t const index) const {
     // NOTE The `decltype(auto)` allows to return either a value (a new instance
     // of the class) or a reference to a value (a scalar).
+    Kokkos::Array<std::size_t, depth + 1> indices = extendIndices(index);
+    BRAK_CHECK_BOUNDS(mData, indices);
+    BRAK_PROFILE_INDICES(mData, depth, indices);
 
     if constexpr (getRank() > 1) {
-      // return wrapper of the subview
-      auto subview = getSubview(index);
-      using ViewCurrent = decltype(subview);
-
+      // return wrapper of the pending subview
       // make the view unmanaged at its first access
       using ViewNext =
-          std::conditional_t<ViewCurrent::traits::memory_traits::is_unmanaged,
-                             ViewCurrent,
-                             kokkos_addendum::make_unmanaged<ViewCurrent>>;
+          std::conditional_t<View::traits::memory_traits::is_unmanaged, View,
+                             kokkos_addendum::make_unmanaged<View>>;
       // NOTE This disables reference counting on CPU for each view created in
       // each successive wrapper retrieved, which greatly improves performance.
       // On GPU, reference counting of views is already disabled by default.
 
-      return WrapperSubview<ViewNext>(subview);
+      return WrapperSubview<ViewNext, depth + 1>(mData, indices);
     } else {
       // return a reference to a scalar
-      return mData(index);
+      return getValue(indices);
     }
   }
 
@@ -79,74 +113,268 @@ public:
    * `std::size_t`.
    * @param indices Pack of indices. The number of indices must match the rank
    * of the current wrapper.
-   * @return Reference to a scalar of the view at the given indices.
+   * @return Reference to a scalar of the view at the given indices, or atomic
+   * proxy if the wrapped view is atomic.
    */
   template <typename... IndicesType>
-  KOKKOS_FUNCTION constexpr auto &operator()(IndicesType const... indices) const {
+  KOKKOS_FUNCTION constexpr decltype(auto)
+  operator()(IndicesType const... indices) const {
     static_assert(sizeof...(indices) == getRank(), "Rank mismatch");
 
+    Kokkos::Array<std::size_t, getRankSource()> indicesJoined =
+        extendIndices(static_cast<std::size_t>(indices)...);
+    BRAK_CHECK_BOUNDS(mData, indicesJoined);
+    BRAK_PROFILE_INDICES(mData, depth, indicesJoined);
+
     // return reference to scalar
-    return mData(static_cast<std::size_t>(indices)...);
+    return getValue(indicesJoined);
   }
 
   /**
-   * Defer the wrapper to the pointer data in the wrapped view.
+   * Defer the wrapper to the pointer data in the wrapped subview.
    * @return Raw pointer to the wrapped data.
    * @note This method may give access to data that are not contiguous in
    * memory and lead to unpredictable behaviors.
    */
   KOKKOS_FUNCTION
-  typename View::value_type *operator*() { return mData.data(); }
+  typename View::value_type *operator*() {
+    BRAK_PROFILE_ESCAPE(mData);
+
+    return getSubview().data();
+  }
+
+  /**
+   * Retrieve the wrapped subview, which is materialized.
+   * @return Wrapped view if the wrapper is at the top level, subview
+   * otherwise.
+   */
+  KOKKOS_FUNCTION
+  Subview getView() const {
+    BRAK_PROFILE_ESCAPE(mData);
+
+    return getSubview();
+  }
+
+  /**
+   * Convert the wrapper to the wrapped subview, which is materialized, so that
+   * it can be handed to functions expecting a view.
+   * @return Wrapped view if the wrapper is at the top level, subview
+   * otherwise.
+   */
+  KOKKOS_FUNCTION
+  operator Subview() const { return getView(); }
+
+  /**
+   * Create a wrapper of the same indices whose accesses are atomic.
+   * The wrapped view is recreated with the atomic memory trait, so that the
+   * accesses return atomic proxies, which can be used for concurrent
+   * accumulations.
+   * @return Atomic wrapper.
+   */
+  KOKKOS_FUNCTION
+  auto atomic() const {
+    using ViewAtomic = kokkos_addendum::make_unmanaged_atomic<View>;
+
+    return WrapperSubview<ViewAtomic, depth>(ViewAtomic(mData), mIndices);
+  }
+
+  /**
+   * Create a wrapper of the same indices whose accesses are read-only.
+   * The wrapped view is recreated with constant data and the random access
+   * memory trait, so that the accesses return constant references, which can
+   * be loaded through read-only caches on GPU.
+   * @return Read-only wrapper.
+   */
+  KOKKOS_FUNCTION
+  auto readonly() const {
+    using ViewReadonly = kokkos_addendum::make_unmanaged_readonly<View>;
+
+    return WrapperSubview<ViewReadonly, depth>(ViewReadonly(mData),
+                                               mIndices);
+  }
+
+  /**
+   * Create a wrapper of the same indices whose accesses are not aliased.
+   * The wrapped view is recreated with the restrict memory trait, which is
+   * kept by the sub-wrappers, so that the compiler can assume that the
+   * accesses do not alias the accesses to any other view, as for
+   * vectorization.
+   * @return Restrict wrapper.
+   * @note The data must not be accessed through any other view or wrapper in
+   * the same kernel, otherwise the behavior is undefined.
+   */
+  KOKKOS_FUNCTION
+  auto restrict() const {
+    using ViewRestrict = kokkos_addendum::make_unmanaged_restrict<View>;
+
+    return WrapperSubview<ViewRestrict, depth>(ViewRestrict(mData),
+                                               mIndices);
+  }
 
   /**
-   * Retrieve the wrapped view.
-   * @return Copy of the wrapped view.
+   * Get the extent of a dimension of the wrapper.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Extent of the dimension.
    */
   KOKKOS_FUNCTION
-  View getView() { return mData; }
+  std::size_t getExtent(std::size_t const dimension) const {
+    return mData.extent(depth + dimension);
+  }
+
+  /**
+   * Get the stride of a dimension of the wrapper.
+   * @param dimension Dimension of the wrapper, starting from 0 for the
+   * left-most one.
+   * @return Stride of the dimension, in number of elements.
+   */
+  KOKKOS_FUNCTION
+  std::size_t getStride(std::size_t const dimension) const {
+    return mData.stride(depth + dimension);
+  }
+
+  /**
+   * Get the number of elements of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Number of elements.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION std::size_t size() const {
+    static_assert(rank == 1, "Size is only available for a rank of 1");
+
+    return getExtent(0);
+  }
+
+  /**
+   * Get an iterator to the first element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Raw pointer if the elements are known at compile time to be
+   * contiguous, strided iterator otherwise.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION auto begin() const {
+    static_assert(rank == 1, "Iterators are only available for a rank of 1");
+
+    typename View::value_type *const pointer =
+        &getValue(extendIndices(std::size_t(0)));
+
+    if constexpr (kokkos_addendum::has_unit_stride<View, getRankSource() - 1>) {
+      // return a raw pointer, which is the best for vectorization
+      return pointer;
+    } else {
+      // return an iterator that jumps over the stride
+      return StridedIterator<typename View::value_type>(
+          pointer, static_cast<std::ptrdiff_t>(getStride(0)));
+    }
+  }
+
+  /**
+   * Get an iterator past the last element of a wrapper of rank 1.
+   * @tparam rank Rank of the wrapper. It is a template parameter, so that the
+   * method is only instantiated when used.
+   * @return Raw pointer if the elements are known at compile time to be
+   * contiguous, strided iterator otherwise.
+   */
+  template <std::size_t rank = View::rank() - depth>
+  KOKKOS_FUNCTION auto end() const {
+    return begin<rank>() + static_cast<std::ptrdiff_t>(size<rank>());
+  }
 
 private:
   /**
-   * Extract a subview of accurate rank.
-   * @param index Left-most index to extract from the wrapped view.
-   * @return Subview.
-   * @note Can only be used when the rank of the wrapped view is between 2
-   * and 8.
+   * Recreate an array of indices with new indices.
+   * @tparam IndicesType Type of the indices.
+   * @param indices Pack of indices.
+   * @return Extended array of indices.
+   */
+  template <typename... IndicesType>
+  KOKKOS_FUNCTION constexpr Kokkos::Array<std::size_t,
+                                         depth + sizeof...(IndicesType)>
+  extendIndices(IndicesType const... indices) const {
+    return extendIndices(std::make_index_sequence<depth>(), indices...);
+  }
+
+  /**
+   * Recreate an array of indices with new indices and an index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @tparam IndicesType Type of the indices.
+   * @param indexSequenceArg Index sequence of the indices from 0 to `depth` to
+   * access `mIndices`.
+   * @param indices Pack of indices.
+   * @return Extended array of indices.
+   */
+  template <std::size_t... indexSequence, typename... IndicesType>
+  KOKKOS_FUNCTION constexpr Kokkos::Array<std::size_t,
+                                         depth + sizeof...(IndicesType)>
+  extendIndices(
+      [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg,
+      IndicesType const... indices) const {
+    return {{mIndices[indexSequence]..., indices...}};
+  }
+
+  /**
+   * Get the scalar value of the wrapped view from an array of indices.
+   * @param indices Array of indices of all the dimensions of the view.
+   * @return Scalar value of the view.
    */
   KOKKOS_FUNCTION
-  auto getSubview(std::size_t const index) const {
-    static_assert(getRank() <= 8, "Rank of view too large");
-    static_assert(getRank() > 1, "Rank of view too small");
-
-    // NOTE It's probably possible to write templated code to not handle all
-    // the dimensions manually, but it's a lot of troubles for just 8
-    // dimensions.
-
-    using Kokkos::ALL;
-
-    if constexpr (getRank() == 8) {
-      // return a subview of rank 7
-      return Kokkos::subview(mData, index, ALL, ALL, ALL, ALL, ALL, ALL, ALL);
-    } else if constexpr (getRank() == 7) {
-      // return a subview of rank 6
-      return Kokkos::subview(mData, index, ALL, ALL, ALL, ALL, ALL, ALL);
-    } else if constexpr (getRank() == 6) {
-      // return a subview of rank 5
-      return Kokkos::subview(mData, index, ALL, ALL, ALL, ALL, ALL);
-    } else if constexpr (getRank() == 5) {
-      // return a subview of rank 4
-      return Kokkos::subview(mData, index, ALL, ALL, ALL, ALL);
-    } else if constexpr (getRank() == 4) {
-      // return a subview of rank 3
-      return Kokkos::subview(mData, index, ALL, ALL, ALL);
-    } else if constexpr (getRank() == 3) {
-      // return a subview of rank 2
-      return Kokkos::subview(mData, index, ALL, ALL);
+  constexpr decltype(auto)
+  getValue(Kokkos::Array<std::size_t, getRankSource()> const &indices) const {
+    return getValue(indices, std::make_index_sequence<getRankSource()>());
+  }
+
+  /**
+   * Get the scalar value of the wrapped view from an array of indices and an
+   * index sequence.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @param indices Array of indices of all the dimensions of the view.
+   * @param indexSequenceArg Index sequence of the indices from 0 to the rank
+   * of the view to access `indices`.
+   * @return Scalar value of the view.
+   */
+  template <std::size_t... indexSequence>
+  KOKKOS_FUNCTION constexpr decltype(auto)
+  getValue(Kokkos::Array<std::size_t, getRankSource()> const &indices,
+           [[maybe_unused]] std::index_sequence<indexSequence...>
+               indexSequenceArg) const {
+    return mData(indices[indexSequence]...);
+  }
+
+  /**
+   * Materialize the subview of the pending indices.
+   * @return Wrapped view if the wrapper is at the top level, subview
+   * otherwise.
+   */
+  KOKKOS_FUNCTION
+  Subview getSubview() const {
+    if constexpr (depth == 0) {
+      return mData;
     } else {
-      // return a subview of rank 1
-      return Kokkos::subview(mData, index, ALL);
+      return getSubview(std::make_index_sequence<depth>(),
+                        std::make_index_sequence<getRank()>());
     }
   }
+
+  /**
+   * Materialize the subview of the pending indices from index sequences.
+   * @tparam indexSequence Index sequence (automatically deduced).
+   * @tparam allSequence Index sequence (automatically deduced).
+   * @param indexSequenceArg Index sequence of the indices from 0 to `depth` to
+   * access `mIndices`.
+   * @param allSequenceArg Index sequence of the remaining dimensions, which
+   * are entirely kept.
+   * @return Subview.
+   */
+  template <std::size_t... indexSequence, std::size_t... allSequence>
+  KOKKOS_FUNCTION Subview getSubview(
+      [[maybe_unused]] std::index_sequence<indexSequence...> indexSequenceArg,
+      [[maybe_unused]] std::index_sequence<allSequence...> allSequenceArg)
+      const {
+    return Kokkos::subview(mData, mIndices[indexSequence]...,
+                           (static_cast<void>(allSequence), Kokkos::ALL)...);
+  }
 };
 
 } // namespace brak
@@ -0,0 +1,4 @@
+#include "brak/prebuilt.hpp"
+
+// define the instantiations declared in the header
+BRAK_PREBUILT()
@@ -0,0 +1,112 @@
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/aliasing.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_subview.hpp"
+
+using View =
+    Kokkos::View<int **, Kokkos::DefaultHostExecutionSpace::memory_space>;
+using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+TEST(test_aliasing, test_readonly_wrapper_array) {
+  View data{"data", 3, 2};
+  View dataTemp{"dataTemp", 3, 2};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+  auto const dataReadonly = brak::readonly(dataWrapper);
+
+  using ViewReadonly = decltype(dataReadonly.getView());
+  static_assert(ViewReadonly::traits::memory_traits::is_random_access);
+  static_assert(
+      std::is_same_v<decltype(dataReadonly[0][0]), int const &>);
+  static_assert(std::is_same_v<decltype(dataReadonly[1]),
+                               decltype(dataWrapper[1].readonly())>);
+
+  data(1, 0) = 4;
+  data(2, 1) = 5;
+
+  Kokkos::parallel_for(
+      "test_readonly_wrapper_array", Policy(0, 3), KOKKOS_LAMBDA(int const i) {
+        dataTempWrapper[i][0] = dataReadonly[i][0] + dataReadonly[i](1);
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(0, 0), 0);
+  ASSERT_EQ(dataTemp(1, 0), 4);
+  ASSERT_EQ(dataTemp(2, 0), 5);
+}
+
+TEST(test_aliasing, test_restrict_wrapper_array) {
+  View data{"data", 3, 2};
+  View dataTemp{"dataTemp", 3, 2};
+  auto const dataRestrict = brak::restrict(brak::WrapperArray{data});
+  auto const dataTempRestrict = brak::restrict(brak::WrapperArray{dataTemp});
+
+  using ViewRestrict = decltype(dataRestrict.getView());
+  using ViewRestrictNext = decltype(dataRestrict[0].getView());
+  static_assert(ViewRestrict::traits::memory_traits::is_restrict);
+  static_assert(ViewRestrictNext::traits::memory_traits::is_restrict);
+
+  data(0, 1) = 2;
+  data(2, 0) = 3;
+
+  Kokkos::parallel_for(
+      "test_restrict_wrapper_array", Policy(0, 3), KOKKOS_LAMBDA(int const i) {
+        for (int j = 0; j < 2; j++) {
+          dataTempRestrict[i][j] = 2 * dataRestrict[i][j];
+        }
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(0, 1), 4);
+  ASSERT_EQ(dataTemp(2, 0), 6);
+  ASSERT_EQ(dataTemp(1, 1), 0);
+}
+
+TEST(test_aliasing, test_readonly_restrict_wrapper_subview) {
+  View data{"data", 3, 2};
+  View dataTemp{"dataTemp", 3, 2};
+  brak::WrapperSubview dataWrapper{data};
+  brak::WrapperSubview dataTempWrapper{dataTemp};
+  auto const dataReadonly = brak::readonly(dataWrapper[1]);
+  auto const dataTempRestrict = brak::restrict(dataTempWrapper[2]);
+
+  static_assert(std::is_same_v<decltype(dataReadonly[0]), int const &>);
+  static_assert(
+      decltype(dataTempRestrict.getView())::traits::memory_traits::is_restrict);
+
+  data(1, 0) = 7;
+  data(1, 1) = 8;
+
+  Kokkos::parallel_for(
+      "test_readonly_restrict_wrapper_subview", Policy(0, 2),
+      KOKKOS_LAMBDA(int const j) { dataTempRestrict[j] = dataReadonly[j]; });
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(2, 0), 7);
+  ASSERT_EQ(dataTemp(2, 1), 8);
+  ASSERT_EQ(dataTemp(1, 0), 0);
+}
+
+TEST(test_aliasing, test_readonly_restrict_view) {
+  View data{"data", 3, 2};
+  View dataTemp{"dataTemp", 3, 2};
+  auto const dataReadonly = brak::readonly(data);
+  auto const dataTempRestrict = brak::restrict(dataTemp);
+
+  static_assert(std::is_same_v<decltype(dataReadonly(0, 0)), int const &>);
+  static_assert(
+      decltype(dataTempRestrict)::traits::memory_traits::is_restrict);
+
+  data(2, 1) = 9;
+
+  // the restrict view is the only one to access its data
+  dataTempRestrict(2, 1) = 2 * dataReadonly(2, 1);
+
+  ASSERT_EQ(dataTemp(2, 1), 18);
+  ASSERT_EQ(dataReadonly.data(), data.data());
+  ASSERT_EQ(dataTempRestrict.data(), dataTemp.data());
+}
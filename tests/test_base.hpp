@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <numeric>
+
 #include <Kokkos_Core.hpp>
 #include <gtest/gtest.h>
 
@@ -158,6 +161,68 @@ TEST(GET_TEST_NAME(WRAPPER_NAME), test_get_view) {
   ASSERT_EQ(data.data(), dataView.data());
 }
 
+TEST(GET_TEST_NAME(WRAPPER_NAME), test_extent_stride) {
+  Kokkos::View<int ***, Kokkos::HostSpace> data{"data", 4, 5, 6};
+  WRAPPER_CLASS dataWrapper{data};
+
+  ASSERT_EQ(dataWrapper.getExtent(0), 4);
+  ASSERT_EQ(dataWrapper.getExtent(2), 6);
+  ASSERT_EQ(dataWrapper[1].getExtent(0), 5);
+  ASSERT_EQ(dataWrapper[1].getStride(0), data.stride(1));
+  ASSERT_EQ(dataWrapper[1][2].size(), 6);
+}
+
+TEST(GET_TEST_NAME(WRAPPER_NAME), test_iterate) {
+  Kokkos::View<int **, Kokkos::LayoutRight, Kokkos::HostSpace> data{"data", 4,
+                                                                    5};
+  WRAPPER_CLASS dataWrapper{data};
+
+  static_assert(std::is_pointer_v<decltype(dataWrapper[1].begin())>);
+
+  for (auto &value : dataWrapper[1]) {
+    value = 1;
+  }
+
+  for (std::size_t j = 0; j < 5; j++) {
+    ASSERT_EQ(data(0, j), 0);
+    ASSERT_EQ(data(1, j), 1);
+  }
+}
+
+TEST(GET_TEST_NAME(WRAPPER_NAME), test_iterate_layout_left) {
+  Kokkos::View<int **, Kokkos::LayoutLeft, Kokkos::HostSpace> data{"data", 4,
+                                                                   5};
+  WRAPPER_CLASS dataWrapper{data};
+
+  static_assert(!std::is_pointer_v<decltype(dataWrapper[1].begin())>);
+  ASSERT_EQ(dataWrapper[1].end() - dataWrapper[1].begin(), 5);
+
+  for (auto &value : dataWrapper[1]) {
+    value = 1;
+  }
+
+  for (std::size_t j = 0; j < 5; j++) {
+    ASSERT_EQ(data(0, j), 0);
+    ASSERT_EQ(data(1, j), 1);
+  }
+}
+
+TEST(GET_TEST_NAME(WRAPPER_NAME), test_iterate_algorithm) {
+  Kokkos::View<int **, Kokkos::LayoutLeft, Kokkos::HostSpace> data{"data", 4,
+                                                                   5};
+  WRAPPER_CLASS dataWrapper{data};
+
+  auto row = dataWrapper[1];
+  std::iota(row.begin(), row.end(), 0);
+  std::transform(row.begin(), row.end(), dataWrapper[2].begin(),
+                 [](int const value) { return value * 2; });
+
+  ASSERT_EQ(data(1, 4), 4);
+  ASSERT_EQ(data(2, 4), 8);
+  ASSERT_EQ(std::accumulate(dataWrapper[2].begin(), dataWrapper[2].end(), 0),
+            20);
+}
+
 TEST(GET_TEST_NAME_INTEGRATION(WRAPPER_NAME), test_access_nested_for) {
   Kokkos::View<int ******, Kokkos::DefaultHostExecutionSpace::memory_space>
       data{"data", 2, 2, 2, 2, 2, 2};
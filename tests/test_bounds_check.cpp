@@ -0,0 +1,103 @@
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_range.hpp"
+#include "brak/wrapper_subview.hpp"
+
+#ifndef BRAK_ENABLE_BOUNDS_CHECK
+#error "This test must be built with bounds checking"
+#endif
+
+using View =
+    Kokkos::View<int ***, Kokkos::DefaultHostExecutionSpace::memory_space>;
+
+TEST(test_bounds_check, test_in_bounds) {
+  View data{"data", 2, 3, 4};
+  brak::WrapperArray dataWrapperArray{data};
+  brak::WrapperSubview dataWrapperSubview{data};
+
+  dataWrapperArray[1][2][3] = 10;
+  ASSERT_EQ(dataWrapperArray(1, 2, 3), 10);
+  ASSERT_EQ(dataWrapperSubview[1][2][3], 10);
+  ASSERT_EQ(dataWrapperSubview(1, 2, 3), 10);
+}
+
+TEST(test_bounds_check_death_test, test_wrapper_array_brackets) {
+  View data{"data", 2, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  ASSERT_DEATH(dataWrapper[1][3][0] = 10,
+               "view \"data\" with indices \\(1, 3\\) for extents \\(2, 3\\)");
+  ASSERT_DEATH(dataWrapper[1][2][4] = 10,
+               "indices \\(1, 2, 4\\) for extents \\(2, 3, 4\\)");
+}
+
+TEST(test_bounds_check_death_test, test_wrapper_array_parentheses) {
+  View data{"data", 2, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  ASSERT_DEATH(dataWrapper(2, 0, 0) = 10,
+               "view \"data\" with indices \\(2, 0, 0\\)");
+  ASSERT_DEATH(dataWrapper[1](0, 5) = 10,
+               "view \"data\" with indices \\(1, 0, 5\\)");
+}
+
+TEST(test_bounds_check_death_test, test_wrapper_array_signed_index) {
+  View data{"data", 2, 3, 4};
+  brak::WrapperArray<View, 0, std::int32_t> dataWrapper{data};
+
+  ASSERT_DEATH(dataWrapper[-1][0][0] = 10,
+               "view \"data\" with indices \\(-1\\) for extents \\(2\\)");
+}
+
+TEST(test_bounds_check_death_test, test_wrapper_array_tiled) {
+  auto dataWrapper = brak::create_wrapper_tiled<View, 2, 2, 2>("data", 2, 4, 4);
+
+  // the indices of the tiles are checked against the number of tiles
+  ASSERT_DEATH(dataWrapper[1][4][0] = 10,
+               "indices \\(0, 2\\) for extents \\(1, 2\\)");
+  ASSERT_DEATH(dataWrapper(2, 0, 0) = 10,
+               "indices \\(1, 0, 0, 0, 0, 0\\) for extents "
+               "\\(1, 2, 2, 2, 2, 2\\)");
+}
+
+TEST(test_bounds_check_death_test, test_wrapper_subview) {
+  View data{"data", 2, 3, 4};
+  brak::WrapperSubview dataWrapper{data};
+
+  ASSERT_DEATH(dataWrapper[1][3][0] = 10,
+               "view \"data\" with indices \\(1, 3\\) for extents \\(2, 3\\)");
+  ASSERT_DEATH(dataWrapper(1, 2, 4) = 10,
+               "view \"data\" with indices \\(1, 2, 4\\)");
+}
+
+TEST(test_bounds_check_death_test, test_wrapper_range) {
+  View data{"data", 6, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+  auto dataRange = dataWrapper[brak::range(2, 4)];
+
+  // the indices are checked against the range, not against the view
+  ASSERT_DEATH(dataRange[2][0][0] = 10,
+               "view \"data\" with indices \\(2\\) for extents \\(2\\)");
+  ASSERT_DEATH(dataRange(1, 3, 0) = 10,
+               "indices \\(1, 3, 0\\) for extents \\(2, 3, 4\\)");
+  ASSERT_DEATH(dataWrapper[1][0][brak::range(0, 4, 2)][2] = 10,
+               "indices \\(2\\) for extents \\(2\\)");
+}
+
+TEST(test_bounds_check_death_test, test_wrapper_range_invalid) {
+  View data{"data", 6, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  ASSERT_DEATH(dataWrapper[brak::range(0, 6, 0)],
+               "range of view \"data\" from 0 to 6 with step 0");
+  ASSERT_DEATH(dataWrapper[brak::range(2, 7)],
+               "range of view \"data\" from 2 to 7 with step 1 for extent 6");
+  ASSERT_DEATH(dataWrapper[brak::range(2, 4)][brak::range(0, 3)],
+               "from 0 to 3 with step 1 for extent 2");
+  ASSERT_DEATH(dataWrapper[brak::range(4, 2)],
+               "from 4 to 2 with step 1 for extent 6");
+}
@@ -0,0 +1,156 @@
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/expression.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_subview.hpp"
+
+using View =
+    Kokkos::View<double **, Kokkos::DefaultHostExecutionSpace::memory_space>;
+using ViewLeft =
+    Kokkos::View<double ***, Kokkos::LayoutLeft,
+                 Kokkos::DefaultHostExecutionSpace::memory_space>;
+
+TEST(test_expression, test_copy_wrapper_array) {
+  View data{"data", 3, 2};
+  View dataTemp{"dataTemp", 3, 2};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+
+  data(0, 1) = 1;
+  data(2, 0) = 2;
+
+  brak::expr(dataTempWrapper) = dataWrapper;
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(0, 1), 1);
+  ASSERT_EQ(dataTemp(2, 0), 2);
+  ASSERT_EQ(dataTemp(1, 1), 0);
+}
+
+TEST(test_expression, test_combination_wrapper_array) {
+  ViewLeft data{"data", 2, 3, 4};
+  ViewLeft dataOther{"dataOther", 2, 3, 4};
+  ViewLeft dataTemp{"dataTemp", 2, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataOtherWrapper{dataOther};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+  double const coeff = 0.5;
+
+  static_assert(!std::is_arithmetic_v<decltype(dataWrapper[1] + 1)>);
+
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) {
+      for (int k = 0; k < 4; k++) {
+        data(i, j, k) = i + j + k;
+        dataOther(i, j, k) = 2 * k;
+      }
+    }
+  }
+
+  // only the second sub-wrapper is assigned
+  brak::expr(dataTempWrapper[1]) =
+      dataWrapper[1] + coeff * dataOtherWrapper[1] - 1;
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(1, 0, 0), 0);
+  ASSERT_EQ(dataTemp(1, 2, 3), 8);
+  ASSERT_EQ(dataTemp(0, 2, 3), 0);
+
+  brak::expr(dataTempWrapper) = (dataWrapper - dataOtherWrapper) / 2;
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(0, 2, 3), -0.5);
+  ASSERT_EQ(dataTemp(1, 1, 0), 1);
+}
+
+TEST(test_expression, test_wrapper_subview) {
+  View data{"data", 3, 2};
+  View dataTemp{"dataTemp", 3, 2};
+  brak::WrapperSubview dataWrapper{data};
+  brak::WrapperSubview dataTempWrapper{dataTemp};
+
+  data(1, 0) = 3;
+  data(1, 1) = 4;
+
+  brak::expr(dataTempWrapper[2]) = dataWrapper[1] * dataWrapper[1];
+  brak::expr(dataTempWrapper[0]) = 7;
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(2, 0), 9);
+  ASSERT_EQ(dataTemp(2, 1), 16);
+  ASSERT_EQ(dataTemp(0, 1), 7);
+  ASSERT_EQ(dataTemp(1, 1), 0);
+}
+
+TEST(test_expression, test_assign_target) {
+  View data{"data", 3, 2};
+  View dataTemp{"dataTemp", 3, 2};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataTempWrapper{dataTemp};
+
+  data(2, 1) = 5;
+
+  // assigning a target copies the elements, and does not rebind it
+  auto target = brak::expr(dataTempWrapper);
+  target = brak::expr(dataWrapper);
+  Kokkos::fence();
+
+  ASSERT_EQ(dataTemp(2, 1), 5);
+  ASSERT_NE(dataTemp.data(), data.data());
+}
+
+TEST(test_expression, test_match_loop) {
+  ViewLeft data{"data", 4, 3, 5};
+  ViewLeft dataOther{"dataOther", 4, 3, 5};
+  ViewLeft dataLoop{"dataLoop", 4, 3, 5};
+  ViewLeft dataExpression{"dataExpression", 4, 3, 5};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataOtherWrapper{dataOther};
+  brak::WrapperArray dataLoopWrapper{dataLoop};
+  brak::WrapperArray dataExpressionWrapper{dataExpression};
+  double const coeff = 0.1;
+
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 3; j++) {
+      for (int k = 0; k < 5; k++) {
+        data(i, j, k) = i - j + 0.5 * k;
+        dataOther(i, j, k) = i * j - k;
+      }
+    }
+  }
+
+  // same statement as the expression benchmark, written both ways
+  Kokkos::parallel_for(
+      "test_match_loop",
+      Kokkos::MDRangePolicy<Kokkos::DefaultHostExecutionSpace,
+                            Kokkos::Rank<3>>({0, 0, 0}, {4, 3, 5}),
+      KOKKOS_LAMBDA(int const i, int const j, int const k) {
+        dataLoopWrapper[i][j][k] =
+            dataWrapper[i][j][k] + coeff * dataOtherWrapper[i][j][k];
+      });
+  brak::expr(dataExpressionWrapper) = dataWrapper + coeff * dataOtherWrapper;
+  Kokkos::fence();
+
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 3; j++) {
+      for (int k = 0; k < 5; k++) {
+        ASSERT_EQ(dataExpression(i, j, k), dataLoop(i, j, k));
+      }
+    }
+  }
+}
+
+using test_expression_death_test = ::testing::Test;
+
+TEST(test_expression_death_test, test_extents_mismatch) {
+  View data{"data", 3, 2};
+  View dataOther{"dataOther", 2, 3};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataOtherWrapper{dataOther};
+
+  ASSERT_DEATH(brak::expr(dataWrapper) = dataOtherWrapper + 1,
+               "Extents of the expression do not match");
+}
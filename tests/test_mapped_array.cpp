@@ -0,0 +1,108 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/mapped_array.hpp"
+
+/**
+ * Write a raw binary file of a C array of integers of dimension 3 × 2.
+ * @param path Path to the file.
+ */
+void write_file(std::string const &path) {
+  int data[3][2] = {{0, 1}, {10, 11}, {20, 21}};
+  std::ofstream file{path, std::ios::binary};
+  file.write(reinterpret_cast<char const *>(data), sizeof(data));
+}
+
+TEST(test_mapped_array, test_read) {
+  std::string const path = testing::TempDir() + "test_mapped_array_read.bin";
+  write_file(path);
+
+  {
+    brak::MappedArray<int const, 2> const data{path, 3, 2};
+    data.advise(brak::MappedAccess::sequential);
+
+    static_assert(decltype(data)::getRank() == 2);
+    static_assert(std::is_same_v<decltype(data[1][1]), int const &>);
+    ASSERT_EQ(data.getExtent(0), 3);
+    ASSERT_EQ(data.getExtent(1), 2);
+    ASSERT_EQ(data[0][1], 1);
+    ASSERT_EQ(data[1][0], 10);
+    ASSERT_EQ(data(2, 1), 21);
+    ASSERT_EQ(data.getWrapper()[2][0], 20);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(test_mapped_array, test_read_layout_left) {
+  std::string const path = testing::TempDir() + "test_mapped_array_left.bin";
+  write_file(path);
+
+  {
+    brak::MappedArray<int const, 2, Kokkos::LayoutLeft> const data{path, 2, 3};
+
+    ASSERT_EQ(data[0][1], 10);
+    ASSERT_EQ(data[1][0], 1);
+    ASSERT_EQ(data[1][2], 21);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(test_mapped_array, test_write_private) {
+  std::string const path =
+      testing::TempDir() + "test_mapped_array_private.bin";
+  write_file(path);
+
+  {
+    brak::MappedArray<int, 2> data{path, 3, 2};
+    data[1][1] = 111;
+
+    ASSERT_EQ(data[1][1], 111);
+  }
+
+  {
+    // the modification is not written to the file
+    brak::MappedArray<int const, 2> const data{path, 3, 2};
+    ASSERT_EQ(data[1][1], 11);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(test_mapped_array, test_write_back) {
+  std::string const path = testing::TempDir() + "test_mapped_array_write.bin";
+  write_file(path);
+
+  {
+    brak::MappedArray<int, 2> data{brak::write_back, path, 3, 2};
+    data.advise(brak::MappedAccess::random);
+    data[1][1] = 111;
+
+    // the mapping is moved, and is unmapped only once
+    brak::MappedArray<int, 2> dataMoved{std::move(data)};
+    ASSERT_EQ(dataMoved[1][1], 111);
+  }
+
+  {
+    brak::MappedArray<int const, 2> const data{path, 3, 2};
+    ASSERT_EQ(data[1][1], 111);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(test_mapped_array_death_test, test_file_too_small) {
+  using MappedArray = brak::MappedArray<int const, 2>;
+  std::string const path = testing::TempDir() + "test_mapped_array_small.bin";
+  write_file(path);
+
+  ASSERT_DEATH(MappedArray(path, 4, 2), "File too small for the mapped array");
+
+  std::remove(path.c_str());
+}
@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/mirror.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_offset.hpp"
+#include "brak/wrapper_subview.hpp"
+
+using View = Kokkos::View<int **>;
+
+template <typename ViewHost> void fill(ViewHost const &data) {
+  for (std::size_t i = 0; i < data.extent(0); i++) {
+    for (std::size_t j = 0; j < data.extent(1); j++) {
+      data(i, j) = static_cast<int>(i * 10 + j);
+    }
+  }
+}
+
+TEST(test_mirror, test_create_mirror_wrapper_array) {
+  View data{"data", 3, 2};
+  auto const dataWrapper = brak::make_wrapper(data);
+  auto const dataMirror = brak::create_mirror(dataWrapper);
+
+  using ViewMirror = decltype(dataMirror.getView());
+  static_assert(std::is_same_v<decltype(dataMirror),
+                               brak::WrapperArray<ViewMirror> const>);
+  static_assert(std::is_same_v<typename ViewMirror::memory_space,
+                               Kokkos::HostSpace>);
+
+  ASSERT_EQ(dataMirror.getExtent(0), 3);
+  ASSERT_EQ(dataMirror.getExtent(1), 2);
+  ASSERT_NE(dataMirror.getView().data(), data.data());
+}
+
+TEST(test_mirror, test_create_mirror_view_wrapper_offset) {
+  View data{"data", 3, 2};
+  brak::WrapperOffset const dataWrapper{data};
+  auto const dataMirror = brak::create_mirror_view(dataWrapper);
+
+  using ViewMirror = decltype(dataMirror.getView());
+  static_assert(std::is_same_v<decltype(dataMirror),
+                               brak::WrapperOffset<ViewMirror> const>);
+}
+
+TEST(test_mirror, test_create_mirror_index_type) {
+  View data{"data", 3, 2};
+  brak::WrapperArray<View, 0, std::int32_t> const dataWrapper{data};
+  auto const dataMirror = brak::create_mirror(dataWrapper);
+
+  using ViewMirror = decltype(dataMirror.getView());
+  static_assert(
+      std::is_same_v<decltype(dataMirror),
+                     brak::WrapperArray<ViewMirror, 0, std::int32_t> const>);
+}
+
+TEST(test_mirror, test_deep_copy_async) {
+  View data{"data", 3, 2};
+  auto const dataWrapper = brak::make_wrapper(data);
+  auto const dataMirror = brak::create_mirror(dataWrapper);
+  fill(dataMirror.getView());
+
+  Kokkos::DefaultExecutionSpace exec;
+  brak::deep_copy_async(exec, dataWrapper, dataMirror);
+  exec.fence();
+
+  auto const dataBack = brak::create_mirror(dataWrapper);
+  brak::deep_copy_async(exec, dataBack.getView(), dataWrapper);
+  exec.fence();
+
+  ASSERT_EQ(dataBack[0][0], 0);
+  ASSERT_EQ(dataBack[1][0], 10);
+  ASSERT_EQ(dataBack[2][1], 21);
+}
+
+TEST(test_mirror, test_deep_copy_async_wrapper_subview) {
+  using ViewHost = Kokkos::View<int **, Kokkos::HostSpace>;
+  ViewHost data{"data", 3, 2};
+  ViewHost dataOther{"dataOther", 3, 2};
+  fill(data);
+  brak::WrapperSubview const dataWrapper{data};
+  brak::WrapperSubview const dataOtherWrapper{dataOther};
+
+  // copy the row 1 only
+  Kokkos::DefaultHostExecutionSpace exec;
+  brak::deep_copy_async(exec, dataOtherWrapper[1], dataWrapper[1]);
+  exec.fence();
+
+  ASSERT_EQ(dataOther(1, 0), 10);
+  ASSERT_EQ(dataOther(1, 1), 11);
+  ASSERT_EQ(dataOther(0, 1), 0);
+  ASSERT_EQ(dataOther(2, 0), 0);
+
+  // mirror the row 2 only
+  auto const rowMirror = brak::create_mirror(dataWrapper[2]);
+
+  static_assert(decltype(rowMirror)::getRank() == 1);
+  ASSERT_EQ(rowMirror.getExtent(0), 2);
+}
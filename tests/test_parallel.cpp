@@ -0,0 +1,136 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/parallel.hpp"
+#include "brak/wrapper_array.hpp"
+
+TEST(test_parallel, test_nest_iterate) {
+  using ViewRight = Kokkos::View<int **, Kokkos::LayoutRight>;
+  using ViewLeft = Kokkos::View<int **, Kokkos::LayoutLeft>;
+
+  static_assert(brak::nest_iterate<brak::WrapperArray<ViewRight>> ==
+                Kokkos::Iterate::Right);
+  static_assert(brak::nest_iterate<brak::WrapperArray<ViewLeft>> ==
+                Kokkos::Iterate::Left);
+}
+
+TEST(test_parallel, test_parallel_nest_1d) {
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace::memory_space> data{
+      "data", 10};
+  brak::WrapperArray dataWrapper{data};
+
+  brak::parallel_nest(
+      dataWrapper, KOKKOS_LAMBDA(std::int64_t const i) { dataWrapper[i] = i; });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(7), 7);
+}
+
+TEST(test_parallel, test_parallel_nest_3d) {
+  Kokkos::View<int ***, Kokkos::DefaultHostExecutionSpace::memory_space> data{
+      "data", 4, 5, 6};
+  brak::WrapperArray dataWrapper{data};
+
+  brak::parallel_nest(
+      dataWrapper,
+      KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                    std::int64_t const k) {
+        dataWrapper[i][j][k] = i * 100 + j * 10 + k;
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(3, 2, 1), 321);
+  ASSERT_EQ(data(0, 4, 5), 45);
+}
+
+TEST(test_parallel, test_parallel_nest_bounds_layout_left) {
+  Kokkos::View<int ***, Kokkos::LayoutLeft,
+               Kokkos::DefaultHostExecutionSpace::memory_space>
+      data{"data", 4, 5, 6};
+  brak::WrapperArray dataWrapper{data};
+
+  brak::parallel_nest(
+      "test_parallel_nest_bounds", dataWrapper, {1, 1, 1}, {3, 4, 5},
+      KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j,
+                    std::int64_t const k) { dataWrapper[i][j][k] = 1; });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(0, 1, 1), 0);
+  ASSERT_EQ(data(1, 1, 1), 1);
+  ASSERT_EQ(data(2, 3, 4), 1);
+  ASSERT_EQ(data(3, 3, 4), 0);
+}
+
+TEST(test_parallel, test_parallel_nest_sub_wrapper) {
+  Kokkos::View<int ***, Kokkos::DefaultHostExecutionSpace::memory_space> data{
+      "data", 4, 5, 6};
+  brak::WrapperArray dataWrapper{data};
+  auto subDataWrapper = dataWrapper[2];
+
+  brak::parallel_nest(
+      subDataWrapper,
+      KOKKOS_LAMBDA(std::int64_t const j, std::int64_t const k) {
+        subDataWrapper[j][k] = 1;
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(1, 4, 5), 0);
+  ASSERT_EQ(data(2, 4, 5), 1);
+}
+
+TEST(test_parallel, test_reduce) {
+  Kokkos::View<int **, Kokkos::DefaultHostExecutionSpace::memory_space> data{
+      "data", 4, 5};
+  brak::WrapperArray dataWrapper{data};
+
+  brak::parallel_nest(
+      dataWrapper, KOKKOS_LAMBDA(std::int64_t const i, std::int64_t const j) {
+        dataWrapper[i][j] = i * 10 + j - 5;
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(brak::reduce_max(dataWrapper), 29);
+  ASSERT_EQ(brak::reduce_min(dataWrapper), -5);
+  ASSERT_EQ(brak::reduce_sum(dataWrapper), 240);
+  ASSERT_EQ(brak::reduce_max(dataWrapper, {1, 1}, {3, 4}), 18);
+}
+
+TEST(test_parallel, test_transform_reduce) {
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data1{"data1", 4, 5, 6};
+  Kokkos::View<double ***, Kokkos::DefaultHostExecutionSpace::memory_space>
+      data2{"data2", 4, 5, 6};
+  brak::WrapperArray dataWrapper1{data1};
+  brak::WrapperArray dataWrapper2{data2};
+
+  data1(1, 2, 3) = 3;
+  data2(1, 2, 3) = -1;
+  data2(3, 4, 5) = 2;
+
+  double residual = 0;
+  brak::transform_reduce(
+      dataWrapper1, dataWrapper2,
+      KOKKOS_LAMBDA(double const value1, double const value2) {
+        return Kokkos::abs(value1 - value2);
+      },
+      Kokkos::Max<double>(residual));
+
+  ASSERT_EQ(residual, 4);
+
+  brak::transform_reduce(
+      dataWrapper1, dataWrapper2, {0, 0, 0}, {2, 5, 6},
+      KOKKOS_LAMBDA(double const value1, double const value2) {
+        return Kokkos::abs(value1 - value2);
+      },
+      Kokkos::Sum<double>(residual));
+
+  ASSERT_EQ(residual, 4);
+
+  double squares = 0;
+  brak::transform_reduce(
+      dataWrapper2,
+      KOKKOS_LAMBDA(double const value) { return value * value; },
+      Kokkos::Sum<double>(squares));
+
+  ASSERT_EQ(squares, 5);
+}
@@ -0,0 +1,172 @@
+#include <sstream>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/profiling.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_subview.hpp"
+
+#ifndef BRAK_ENABLE_PROFILING
+#error "This test must be built with profiling"
+#endif
+
+using View =
+    Kokkos::View<int ***, Kokkos::DefaultHostExecutionSpace::memory_space>;
+
+TEST(test_profiling, test_wrapper_array) {
+  brak::profiling::Profiler::getInstance().reset();
+
+  View data{"data_array", 2, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  for (std::size_t i = 0; i < 2; i++) {
+    for (std::size_t j = 0; j < 3; j++) {
+      for (std::size_t k = 0; k < 4; k++) {
+        dataWrapper[i][j][k] = 1;
+      }
+    }
+  }
+  dataWrapper(1, 0, 3) = 2;
+  auto view = dataWrapper.getView();
+
+  auto const records = brak::profiling::Profiler::getInstance().collect();
+  auto const &record = records.at("data_array");
+
+  ASSERT_EQ(record.mRank, 3);
+  ASSERT_EQ(record.mAccesses, 25);
+  ASSERT_EQ(record.mEscapes, 1);
+
+  // right-most dimension, walked sequentially, then jumping at each new row
+  ASSERT_EQ(record.mIndexMin[0], 0);
+  ASSERT_EQ(record.mIndexMax[0], 3);
+  ASSERT_EQ(record.mSequential[0], 20);
+  ASSERT_EQ(record.mRandom[0], 5);
+
+  // left-most dimension, always repeated or followed
+  ASSERT_EQ(record.mIndexMax[2], 1);
+  ASSERT_EQ(record.mSequential[2], 25);
+  ASSERT_EQ(record.mRandom[2], 0);
+}
+
+TEST(test_profiling, test_wrapper_subview) {
+  brak::profiling::Profiler::getInstance().reset();
+
+  View data{"data_subview", 2, 3, 4};
+  brak::WrapperSubview dataWrapper{data};
+
+  dataWrapper[1][2][3] = 1;
+  dataWrapper(0, 1, 2) = 1;
+
+  auto const records = brak::profiling::Profiler::getInstance().collect();
+  auto const &record = records.at("data_subview");
+
+  ASSERT_EQ(record.mRank, 3);
+  ASSERT_EQ(record.mAccesses, 2);
+  ASSERT_EQ(record.mIndexMin[0], 2);
+  ASSERT_EQ(record.mIndexMax[0], 3);
+  ASSERT_EQ(record.mIndexMin[2], 0);
+  ASSERT_EQ(record.mIndexMax[2], 1);
+}
+
+TEST(test_profiling, test_interleaved_views) {
+  brak::profiling::Profiler::getInstance().reset();
+
+  View data{"data_first", 2, 3, 4};
+  View dataOther{"data_second", 2, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataOtherWrapper{dataOther};
+
+  // the last accessed view changes at each access
+  for (std::size_t k = 0; k < 4; k++) {
+    dataWrapper[0][0][k] = 1;
+    dataOtherWrapper[1][1][k] = dataWrapper[0][0][k];
+  }
+
+  auto const records = brak::profiling::Profiler::getInstance().collect();
+
+  ASSERT_EQ(records.at("data_first").mAccesses, 8);
+  ASSERT_EQ(records.at("data_second").mAccesses, 4);
+  ASSERT_EQ(records.at("data_second").mIndexMin[2], 1);
+}
+
+TEST(test_profiling, test_kernels) {
+  brak::profiling::Profiler::getInstance().reset();
+
+  View data{"data_kernels", 2, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  Kokkos::parallel_for(
+      "kernel_first",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, 3),
+      KOKKOS_LAMBDA(int const j) { dataWrapper[1][j][0] = 1; });
+  Kokkos::fence();
+
+  Kokkos::Profiling::pushRegion("region_second");
+  dataWrapper[0][0][0] = 1;
+  auto view = dataWrapper.getView();
+  Kokkos::Profiling::popRegion();
+
+  dataWrapper[0][1][0] = 1;
+
+  auto const records =
+      brak::profiling::Profiler::getInstance().collectKernels();
+  auto const &recordsKernels = records.at("data_kernels");
+
+  ASSERT_EQ(recordsKernels.size(), 3);
+  ASSERT_EQ(recordsKernels.at("kernel_first").mAccesses, 3);
+  ASSERT_EQ(recordsKernels.at("kernel_first").mEscapes, 0);
+  ASSERT_EQ(recordsKernels.at("region_second").mAccesses, 1);
+  ASSERT_EQ(recordsKernels.at("region_second").mEscapes, 1);
+  ASSERT_EQ(recordsKernels.at("").mAccesses, 1);
+
+  std::ostringstream stream;
+  brak::profiling::Profiler::dump(stream);
+
+  ASSERT_NE(stream.str().find("view \"data_kernels\": 5 accesses, 1 escapes"),
+            std::string::npos);
+  ASSERT_NE(stream.str().find("  kernel \"kernel_first\": 3 accesses, 0 "
+                              "escapes\n"),
+            std::string::npos);
+  ASSERT_NE(stream.str().find("  outside kernels: 1 accesses, 0 escapes\n"),
+            std::string::npos);
+}
+
+TEST(test_profiling, test_reallocated_views) {
+  brak::profiling::Profiler::getInstance().reset();
+
+  // the second view may be allocated at the address of the first one
+  {
+    View data{"data_freed", 2, 3, 4};
+    brak::WrapperArray dataWrapper{data};
+    dataWrapper[1][2][3] = 1;
+  }
+  {
+    View data{"data_reallocated", 2, 3, 4};
+    brak::WrapperArray dataWrapper{data};
+    dataWrapper[1][2][3] = 1;
+    dataWrapper[0][2][3] = 1;
+  }
+
+  auto const records = brak::profiling::Profiler::getInstance().collect();
+
+  ASSERT_EQ(records.at("data_freed").mAccesses, 1);
+  ASSERT_EQ(records.at("data_reallocated").mAccesses, 2);
+}
+
+TEST(test_profiling, test_dump) {
+  brak::profiling::Profiler::getInstance().reset();
+
+  View data{"data_dump", 2, 3, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  dataWrapper[1][2][3] = 1;
+
+  std::ostringstream stream;
+  brak::profiling::Profiler::dump(stream);
+
+  ASSERT_NE(stream.str().find("view \"data_dump\": 1 accesses, 0 escapes"),
+            std::string::npos);
+  ASSERT_NE(stream.str().find("dimension 2: indices [3, 3]"),
+            std::string::npos);
+}
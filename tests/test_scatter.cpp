@@ -0,0 +1,69 @@
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/scatter.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_subview.hpp"
+
+using View =
+    Kokkos::View<int **, Kokkos::DefaultHostExecutionSpace::memory_space>;
+using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+TEST(test_scatter, test_atomic_wrapper_array) {
+  View data{"data", 3, 2};
+  brak::WrapperArray dataWrapper{data};
+  auto const dataAtomic = dataWrapper.atomic();
+
+  using ViewAtomic = decltype(dataAtomic.getView());
+  static_assert(ViewAtomic::traits::memory_traits::is_atomic);
+  static_assert(!std::is_reference_v<decltype(dataAtomic[0][0])>);
+
+  Kokkos::parallel_for(
+      "test_atomic_wrapper_array", Policy(0, 300), KOKKOS_LAMBDA(int const p) {
+        dataAtomic[p % 3][1] += 1;
+        dataAtomic[p % 3](0) += 2;
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(0, 1), 100);
+  ASSERT_EQ(data(2, 1), 100);
+  ASSERT_EQ(data(1, 0), 200);
+}
+
+TEST(test_scatter, test_atomic_wrapper_subview) {
+  View data{"data", 3, 2};
+  brak::WrapperSubview dataWrapper{data};
+  auto const dataAtomic = dataWrapper[1].atomic();
+
+  Kokkos::parallel_for(
+      "test_atomic_wrapper_subview", Policy(0, 300),
+      KOKKOS_LAMBDA(int const p) { dataAtomic[p % 2] += 1; });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(1, 0), 150);
+  ASSERT_EQ(data(1, 1), 150);
+  ASSERT_EQ(data(0, 0), 0);
+}
+
+TEST(test_scatter, test_scatter) {
+  View data{"data", 3, 2};
+  brak::WrapperArray dataWrapper{data};
+  auto dataScatter = brak::scatter(dataWrapper);
+
+  static_assert(decltype(dataScatter)::getRank() == 2);
+
+  Kokkos::parallel_for(
+      "test_scatter", Policy(0, 300), KOKKOS_LAMBDA(int const p) {
+        auto access = dataScatter.access();
+        access[p % 3][1] += 1;
+        access(p % 3, 0) += 2;
+      });
+  dataScatter.contribute();
+  Kokkos::fence();
+
+  ASSERT_EQ(data(0, 1), 100);
+  ASSERT_EQ(data(2, 1), 100);
+  ASSERT_EQ(data(1, 0), 200);
+}
@@ -0,0 +1,80 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/scratch.hpp"
+#include "brak/wrapper_array.hpp"
+
+using ExecutionSpace = Kokkos::DefaultHostExecutionSpace;
+using View = Kokkos::View<int ***, ExecutionSpace>;
+using Policy = Kokkos::TeamPolicy<ExecutionSpace>;
+using Member = typename Policy::member_type;
+
+TEST(test_scratch, test_static_extents) {
+  View data{"data", 3, 4, 2};
+  brak::WrapperArray dataWrapper{data};
+
+  Kokkos::parallel_for(
+      "test_static_extents",
+      Policy(3, Kokkos::AUTO)
+          .set_scratch_size(
+              0, Kokkos::PerTeam(
+                     brak::scratch_size<int[4][2], ExecutionSpace>())),
+      KOKKOS_LAMBDA(Member const &team) {
+        auto tile = brak::make_scratch_wrapper<int[4][2]>(team);
+        int const i = team.league_rank();
+
+        static_assert(decltype(tile)::getRank() == 2);
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 4),
+                             [&](int const j) {
+                               tile[j][0] = i * 100 + j * 10;
+                               tile[j][1] = i * 100 + j * 10 + 1;
+                             });
+        team.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 4),
+                             [&](int const j) {
+                               dataWrapper[i][j][0] = tile[3 - j][1];
+                               dataWrapper[i][j][1] = tile(3 - j, 0);
+                             });
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(0, 0, 0), 31);
+  ASSERT_EQ(data(1, 3, 1), 100);
+  ASSERT_EQ(data(2, 1, 0), 221);
+}
+
+TEST(test_scratch, test_dynamic_extents) {
+  View data{"data", 2, 5, 3};
+  brak::WrapperArray dataWrapper{data};
+  int const size = 5;
+
+  Kokkos::parallel_for(
+      "test_dynamic_extents",
+      Policy(2, Kokkos::AUTO)
+          .set_scratch_size(
+              1, Kokkos::PerTeam(
+                     brak::scratch_size<int *[3], ExecutionSpace>(size))),
+      KOKKOS_LAMBDA(Member const &team) {
+        auto tile = brak::make_scratch_wrapper<int *[3]>(team, 1, size);
+        int const i = team.league_rank();
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, size),
+                             [&](int const j) {
+                               for (int k = 0; k < 3; k++) {
+                                 tile[j][k] = i * 100 + j * 10 + k;
+                               }
+                             });
+        team.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, size),
+                             [&](int const j) {
+                               for (int k = 0; k < 3; k++) {
+                                 dataWrapper[i][j][k] = tile[j][k];
+                               }
+                             });
+      });
+  Kokkos::fence();
+
+  ASSERT_EQ(data(0, 4, 2), 42);
+  ASSERT_EQ(data(1, 2, 1), 121);
+}
@@ -0,0 +1,68 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/simd.hpp"
+#include "brak/wrapper_array.hpp"
+
+template <typename Layout> void testLoadStore() {
+  Kokkos::View<double **, Layout, Kokkos::HostSpace> data{"data", 2, 64};
+  brak::WrapperArray dataWrapper{data};
+  using Simd = brak::wrapper_simd<decltype(dataWrapper[0])>;
+  std::size_t const width = Simd::size();
+
+  for (std::size_t k = 0; k < 64; k++) {
+    data(0, k) = k;
+  }
+
+  auto const value = brak::simd_load(dataWrapper[0], 1);
+
+  for (std::size_t lane = 0; lane < width; lane++) {
+    ASSERT_EQ(value[lane], static_cast<double>(1 + lane));
+  }
+
+  brak::simd_store(dataWrapper[1], 2, value);
+
+  ASSERT_EQ(data(1, 1), 0);
+  for (std::size_t lane = 0; lane < width; lane++) {
+    ASSERT_EQ(data(1, 2 + lane), static_cast<double>(1 + lane));
+  }
+  ASSERT_EQ(data(1, 2 + width), 0);
+}
+
+template <typename Layout> void testLoadStoreMasked() {
+  Kokkos::View<double **, Layout, Kokkos::HostSpace> data{"data", 2, 64};
+  brak::WrapperArray dataWrapper{data};
+  using Simd = brak::wrapper_simd<decltype(dataWrapper[0])>;
+  std::size_t const width = Simd::size();
+  std::size_t const count = width > 1 ? width - 1 : 1;
+
+  for (std::size_t k = 0; k < 64; k++) {
+    data(0, k) = k + 1;
+  }
+
+  auto const value = brak::simd_load_masked(dataWrapper[0], 0, count);
+
+  for (std::size_t lane = 0; lane < width; lane++) {
+    ASSERT_EQ(value[lane], lane < count ? static_cast<double>(lane + 1) : 0.);
+  }
+
+  brak::simd_store_masked(dataWrapper[1], 0, Simd(2.), count);
+
+  for (std::size_t lane = 0; lane < width; lane++) {
+    ASSERT_EQ(data(1, lane), lane < count ? 2. : 0.);
+  }
+}
+
+TEST(test_simd, test_load_store) { testLoadStore<Kokkos::LayoutRight>(); }
+
+TEST(test_simd, test_load_store_layout_left) {
+  testLoadStore<Kokkos::LayoutLeft>();
+}
+
+TEST(test_simd, test_load_store_masked) {
+  testLoadStoreMasked<Kokkos::LayoutRight>();
+}
+
+TEST(test_simd, test_load_store_masked_layout_left) {
+  testLoadStoreMasked<Kokkos::LayoutLeft>();
+}
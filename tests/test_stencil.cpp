@@ -0,0 +1,74 @@
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/stencil.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_offset.hpp"
+#include "brak/wrapper_subview.hpp"
+
+template <typename Wrapper> void testAccess(Wrapper const &dataWrapper) {
+  brak::Stencil const stencil{dataWrapper, 2, 3, 4};
+
+  static_assert(decltype(stencil)::getRank() == 3);
+
+  ASSERT_EQ(&stencil(), &dataWrapper[2][3][4]);
+  ASSERT_EQ(&(stencil.template at<0, 0, 0>()), &dataWrapper[2][3][4]);
+  ASSERT_EQ(&(stencil.template at<-1, 0, 0>()), &dataWrapper[1][3][4]);
+  ASSERT_EQ(&(stencil.template at<1, 0, 0>()), &dataWrapper[3][3][4]);
+  ASSERT_EQ(&(stencil.template at<0, -1, 0>()), &dataWrapper[2][2][4]);
+  ASSERT_EQ(&(stencil.template at<0, 1, 0>()), &dataWrapper[2][4][4]);
+  ASSERT_EQ(&(stencil.template at<0, 0, -1>()), &dataWrapper[2][3][3]);
+  ASSERT_EQ(&(stencil.template at<0, 0, 1>()), &dataWrapper[2][3][5]);
+  ASSERT_EQ(&(stencil.template at<-1, 1, -1>()), &dataWrapper[1][4][3]);
+}
+
+TEST(test_stencil, test_access_wrapper_array) {
+  Kokkos::View<int ***, Kokkos::HostSpace> data{"data", 6, 7, 8};
+  testAccess(brak::WrapperArray{data});
+}
+
+TEST(test_stencil, test_access_wrapper_offset) {
+  Kokkos::View<int ***, Kokkos::HostSpace> data{"data", 6, 7, 8};
+  testAccess(brak::WrapperOffset{data});
+}
+
+TEST(test_stencil, test_access_wrapper_subview) {
+  Kokkos::View<int ***, Kokkos::HostSpace> data{"data", 6, 7, 8};
+  testAccess(brak::WrapperSubview{data});
+}
+
+TEST(test_stencil, test_access_layout_left) {
+  Kokkos::View<int ***, Kokkos::LayoutLeft, Kokkos::HostSpace> data{"data", 6,
+                                                                    7, 8};
+  testAccess(brak::WrapperArray{data});
+}
+
+TEST(test_stencil, test_access_sub_wrapper) {
+  Kokkos::View<int ****, Kokkos::HostSpace> data{"data", 3, 6, 7, 8};
+  brak::WrapperArray dataWrapper{data};
+  testAccess(dataWrapper[1]);
+}
+
+TEST(test_stencil, test_write) {
+  Kokkos::View<int ***, Kokkos::HostSpace> data{"data", 6, 7, 8};
+  brak::WrapperArray dataWrapper{data};
+  brak::Stencil const stencil{dataWrapper, 2, 3, 4};
+
+  stencil.at<1, -1, 1>() = 1;
+
+  ASSERT_EQ(data(3, 2, 5), 1);
+}
+
+TEST(test_stencil, test_tiled_rejected) {
+  using View = Kokkos::View<int ***, Kokkos::HostSpace>;
+  auto dataWrapper = brak::create_wrapper_tiled<View, 2, 2, 2>("data", 4, 4, 4);
+
+  // the neighbours of a point at the edge of a tile are in another tile, and
+  // are not reached with a constant stride
+  static_assert(!brak::is_strided<decltype(dataWrapper)>::value);
+  static_assert(brak::is_strided<brak::WrapperArray<View>>::value);
+  static_assert(brak::is_strided<brak::WrapperSubview<View>>::value);
+  static_assert(brak::is_strided<brak::WrapperOffset<View>>::value);
+
+  ASSERT_EQ(dataWrapper.getExtent(0), 4);
+}
@@ -0,0 +1,77 @@
+#include <cstdlib>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/wrap.hpp"
+#include "brak/wrapper_array.hpp"
+
+TEST(test_wrap, test_wrap_c_array) {
+  double data[3][4][2] = {};
+  auto dataWrapper = brak::wrap(data);
+  using View = decltype(dataWrapper.getView());
+
+  static_assert(View::rank() == 3);
+  static_assert(View::rank_dynamic() == 0);
+  static_assert(View::traits::memory_traits::is_unmanaged);
+  static_assert(
+      std::is_same_v<View::traits::array_layout, Kokkos::LayoutRight>);
+
+  dataWrapper[1][2][1] = 10;
+  data[2][3][0] = 20;
+
+  ASSERT_EQ(data[1][2][1], 10);
+  ASSERT_EQ(dataWrapper[2][3][0], 20);
+  ASSERT_EQ(dataWrapper.getExtent(1), 4);
+  ASSERT_EQ(dataWrapper.getView().data(), &data[0][0][0]);
+}
+
+TEST(test_wrap, test_wrap_pointer) {
+  int const size = 5;
+  auto *data = static_cast<double *>(std::malloc(size * 3 * sizeof(double)));
+  auto dataWrapper = brak::wrap(data, size, 3);
+
+  static_assert(decltype(dataWrapper)::getRank() == 2);
+
+  for (int i = 0; i < size * 3; i++) {
+    data[i] = i;
+  }
+
+  ASSERT_EQ(dataWrapper[2][1], 7);
+  ASSERT_EQ(dataWrapper.getExtent(0), 5);
+
+  std::free(data);
+}
+
+TEST(test_wrap, test_wrap_pointer_to_array) {
+  int const size = 3;
+  auto *data = static_cast<double(*)[4][2]>(
+      std::malloc(size * sizeof(double[4][2])));
+  auto dataWrapper = brak::wrap(data, size);
+  using View = decltype(dataWrapper.getView());
+
+  static_assert(View::rank() == 3);
+  static_assert(View::rank_dynamic() == 1);
+
+  dataWrapper[2][1][0] = 30;
+
+  ASSERT_EQ(data[2][1][0], 30);
+  ASSERT_EQ(dataWrapper.getExtent(0), 3);
+  ASSERT_EQ(dataWrapper.getExtent(2), 2);
+
+  std::free(data);
+}
+
+TEST(test_wrap, test_wrap_column_major) {
+  double data[2 * 3] = {0, 1, 2, 3, 4, 5};
+  auto dataWrapper = brak::wrap(brak::column_major, &data[0], 2, 3);
+  using View = decltype(dataWrapper.getView());
+
+  static_assert(std::is_same_v<View::traits::array_layout, Kokkos::LayoutLeft>);
+
+  // the left-most dimension is contiguous
+  ASSERT_EQ(dataWrapper[1][0], 1);
+  ASSERT_EQ(dataWrapper[0][2], 4);
+  ASSERT_EQ(dataWrapper(1, 2), 5);
+}
@@ -1,3 +1,5 @@
+#include <cstdint>
+
 #include "brak/wrapper_array.hpp"
 
 #define WRAPPER_CLASS brak::WrapperArray
@@ -6,3 +8,131 @@
 #define WRAPPER
 
 #include "test_base.hpp"
+
+TEST(test_wrapper_array, test_make_wrapper) {
+  Kokkos::View<int ***, Kokkos::HostSpace> data{"data", 10, 3, 3};
+  auto dataWrapper = brak::make_wrapper(data);
+
+  static_assert(std::is_same_v<decltype(dataWrapper),
+                               brak::WrapperArray<decltype(data)>>);
+}
+
+TEST(test_wrapper_array, test_make_wrapper_static_extents) {
+  Kokkos::View<int ***, Kokkos::HostSpace> data{"data", 10, 3, 3};
+  auto dataWrapper = brak::make_wrapper<3, 3>(data);
+  auto dataStatic = dataWrapper.getView();
+
+  static_assert(decltype(dataWrapper)::getRank() == 3);
+  static_assert(decltype(dataStatic)::rank_dynamic() == 1);
+  static_assert(decltype(dataStatic)::static_extent(1) == 3);
+  static_assert(decltype(dataStatic)::static_extent(2) == 3);
+  ASSERT_EQ(dataStatic.extent(0), 10);
+  ASSERT_EQ(data.data(), dataStatic.data());
+
+  dataWrapper[4][1][2] = 1;
+  dataWrapper(5, 2, 1) = 2;
+
+  ASSERT_EQ(data(4, 1, 2), 1);
+  ASSERT_EQ(data(5, 2, 1), 2);
+}
+
+TEST(test_wrapper_array, test_make_wrapper_static_extents_layout_left) {
+  Kokkos::View<int ***, Kokkos::LayoutLeft, Kokkos::HostSpace> data{"data", 10,
+                                                                    3, 3};
+  auto dataWrapper = brak::make_wrapper<3, 3>(data);
+
+  dataWrapper[4][1][2] = 1;
+
+  ASSERT_EQ(data(4, 1, 2), 1);
+}
+
+TEST(test_wrapper_array, test_make_wrapper_reversed) {
+  Kokkos::View<int ***, Kokkos::LayoutLeft, Kokkos::HostSpace> data{"data", 10,
+                                                                    4, 3};
+  auto dataWrapper = brak::make_wrapper_reversed(data);
+  auto dataReversed = dataWrapper.getView();
+
+  static_assert(std::is_same_v<typename decltype(dataReversed)::array_layout,
+                               Kokkos::LayoutRight>);
+  ASSERT_EQ(dataWrapper.getExtent(0), 3);
+  ASSERT_EQ(dataWrapper.getExtent(1), 4);
+  ASSERT_EQ(dataWrapper.getExtent(2), 10);
+  ASSERT_EQ(data.data(), dataReversed.data());
+
+  dataWrapper[2][1][4] = 1;
+  dataWrapper(1, 3, 5) = 2;
+
+  ASSERT_EQ(data(4, 1, 2), 1);
+  ASSERT_EQ(data(5, 3, 1), 2);
+
+  // the last bracket walks the memory contiguously
+  static_assert(std::is_pointer_v<decltype(dataWrapper[2][1].begin())>);
+  ASSERT_EQ(&dataWrapper[2][1][5], &dataWrapper[2][1][4] + 1);
+}
+
+TEST(test_wrapper_array, test_make_wrapper_reversed_layout_stride) {
+  Kokkos::View<int ***, Kokkos::LayoutLeft, Kokkos::HostSpace> dataLeft{
+      "data", 10, 4, 3};
+  Kokkos::View<int ***, Kokkos::LayoutStride, Kokkos::HostSpace> data =
+      dataLeft;
+  auto dataWrapper = brak::make_wrapper_reversed(data);
+
+  ASSERT_EQ(dataWrapper.getExtent(0), 3);
+  ASSERT_EQ(dataWrapper.getExtent(2), 10);
+  ASSERT_EQ(dataWrapper.getStride(2), 1);
+
+  dataWrapper[2][1][4] = 1;
+
+  ASSERT_EQ(dataLeft(4, 1, 2), 1);
+}
+
+TEST(test_wrapper_array, test_index_type) {
+  using View = Kokkos::View<int ***, Kokkos::HostSpace>;
+  View data{"data", 10, 4, 3};
+  brak::WrapperArray<View, 0, std::int32_t> dataWrapper{data};
+
+  static_assert(
+      std::is_same_v<decltype(dataWrapper[0]),
+                     brak::WrapperArray<kokkos_addendum::make_unmanaged<View>,
+                                        1, std::int32_t>>);
+  static_assert(sizeof(dataWrapper[0][0]) <
+                sizeof(brak::WrapperArray<View>{data}[0][0]));
+
+  for (std::int32_t i = 0; i < 10; i++)
+    for (std::int32_t j = 0; j < 4; j++)
+      for (std::int32_t k = 0; k < 3; k++) {
+        dataWrapper[i][j][k] = i * 100 + j * 10 + k;
+      }
+
+  ASSERT_EQ(data(9, 3, 2), 932);
+  ASSERT_EQ(dataWrapper(4, 1, 2), 412);
+  ASSERT_EQ(dataWrapper[4](1, 2), 412);
+}
+
+TEST(test_wrapper_array, test_create_wrapper_tiled) {
+  using View = Kokkos::View<int ***, Kokkos::HostSpace>;
+  auto dataWrapper = brak::create_wrapper_tiled<View, 2, 2, 4>("data", 4, 6, 8);
+  auto dataTiled = dataWrapper.getView();
+
+  static_assert(decltype(dataWrapper)::getRank() == 3);
+  static_assert(decltype(dataTiled)::rank() == 6);
+  ASSERT_EQ(dataWrapper.getExtent(0), 4);
+  ASSERT_EQ(dataWrapper.getExtent(1), 6);
+  ASSERT_EQ(dataWrapper.getExtent(2), 8);
+  ASSERT_EQ(dataWrapper[1].getExtent(1), 8);
+
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 6; j++)
+      for (int k = 0; k < 8; k++) {
+        dataWrapper[i][j][k] = i * 100 + j * 10 + k;
+      }
+
+  ASSERT_EQ(dataWrapper(3, 5, 7), 357);
+  ASSERT_EQ(dataWrapper[2](3, 6), 236);
+  ASSERT_EQ(dataTiled(1, 1, 1, 0, 1, 2), 236);
+
+  // a tile is contiguous
+  ASSERT_EQ(&dataWrapper[2][3][7], &dataWrapper[2][3][4] + 3);
+  ASSERT_EQ(&dataWrapper[3][3][4], &dataWrapper[2][3][4] + 8);
+  ASSERT_EQ(&dataWrapper[3][2][4], &dataWrapper[2][3][4] + 4);
+}
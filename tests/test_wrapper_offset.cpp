@@ -0,0 +1,6 @@
+#include "brak/wrapper_offset.hpp"
+
+#define WRAPPER_CLASS brak::WrapperOffset
+#define WRAPPER_NAME wrapper_offset
+
+#include "test_base.hpp"
@@ -0,0 +1,162 @@
+#include <iterator>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "brak/expression.hpp"
+#include "brak/wrapper_array.hpp"
+#include "brak/wrapper_range.hpp"
+
+using View =
+    Kokkos::View<double **, Kokkos::DefaultHostExecutionSpace::memory_space>;
+using ViewLeft =
+    Kokkos::View<double ***, Kokkos::LayoutLeft,
+                 Kokkos::DefaultHostExecutionSpace::memory_space>;
+
+TEST(test_wrapper_range, test_range) {
+  View data{"data", 6, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 4; j++) {
+      data(i, j) = 10 * i + j;
+    }
+  }
+
+  auto dataRange = dataWrapper[brak::range(2, 5)];
+
+  static_assert(decltype(dataRange)::getRank() == 2);
+  static_assert(
+      decltype(dataRange.getView())::traits::memory_traits::is_unmanaged);
+
+  ASSERT_EQ(dataRange.getExtent(0), 3);
+  ASSERT_EQ(dataRange.getExtent(1), 4);
+  ASSERT_EQ(dataRange[0][1], 21);
+  ASSERT_EQ(dataRange(2, 3), 43);
+  ASSERT_EQ(dataRange.getView().data(), data.data());
+
+  dataRange[1][2] = -1;
+
+  ASSERT_EQ(data(3, 2), -1);
+}
+
+TEST(test_wrapper_range, test_range_nested) {
+  View data{"data", 6, 4};
+  brak::WrapperArray dataWrapper{data};
+
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 4; j++) {
+      data(i, j) = 10 * i + j;
+    }
+  }
+
+  // slice both dimensions
+  auto dataRange = dataWrapper[brak::range(1, 6)][2][brak::range(1, 3)];
+
+  static_assert(decltype(dataRange)::getRank() == 1);
+
+  ASSERT_EQ(dataRange.size(), 2);
+  ASSERT_EQ(dataRange[0], 31);
+  ASSERT_EQ(dataRange[1], 32);
+
+  // a range of a range is relative to the first one
+  auto dataRangeRange = dataWrapper[brak::range(1, 6)][brak::range(2, 4)];
+
+  ASSERT_EQ(dataRangeRange.getExtent(0), 2);
+  ASSERT_EQ(dataRangeRange[0][0], 30);
+  ASSERT_EQ(dataRangeRange[1][3], 43);
+}
+
+TEST(test_wrapper_range, test_range_strided) {
+  ViewLeft data{"data", 7, 2, 3};
+  brak::WrapperArray dataWrapper{data};
+
+  for (int i = 0; i < 7; i++) {
+    data(i, 1, 2) = i;
+  }
+
+  // every other index from 1, the extent is rounded up
+  auto dataRange = dataWrapper[brak::range(1, 7, 2)];
+
+  ASSERT_EQ(dataRange.getExtent(0), 3);
+  ASSERT_EQ(dataRange.getStride(0), 2 * data.stride(0));
+  ASSERT_EQ(dataRange[0][1][2], 1);
+  ASSERT_EQ(dataRange[2][1][2], 5);
+
+  auto dataRangeStrided = dataWrapper[brak::range(0, 7, 3)];
+
+  ASSERT_EQ(dataRangeStrided.getExtent(0), 3);
+  ASSERT_EQ(dataRangeStrided(2, 1, 2), 6);
+
+  // a strided range of a strided range multiplies the steps
+  ASSERT_EQ(dataRange[brak::range(0, 3, 2)](1, 1, 2), 5);
+}
+
+TEST(test_wrapper_range, test_range_iterator) {
+  View data{"data", 2, 8};
+  brak::WrapperArray dataWrapper{data};
+
+  for (int j = 0; j < 8; j++) {
+    data(1, j) = j;
+  }
+
+  double sum = 0;
+
+  for (auto const &value : dataWrapper[1][brak::range(1, 8, 3)]) {
+    sum += value;
+  }
+
+  ASSERT_EQ(sum, 1 + 4 + 7);
+}
+
+TEST(test_wrapper_range, test_range_empty) {
+  View data{"data", 6, 8};
+  brak::WrapperArray dataWrapper{data};
+
+  auto dataRange = dataWrapper[1][brak::range(3, 3)];
+
+  ASSERT_EQ(dataRange.size(), 0);
+  ASSERT_EQ(dataRange.getStride(0), data.stride(1));
+  ASSERT_TRUE(dataRange.begin() == dataRange.end());
+  ASSERT_EQ(std::distance(dataRange.begin(), dataRange.end()), 0);
+
+  for ([[maybe_unused]] auto const &value : dataRange) {
+    FAIL() << "An empty range has no element";
+  }
+
+  // without bounds checking, a step of 0 gives an empty range, whose stride
+  // is left unchanged
+  auto dataRangeStep = dataWrapper[brak::range(0, 6, 0)];
+
+  ASSERT_EQ(dataRangeStep.getExtent(0), 0);
+  ASSERT_EQ(dataRangeStep.getStride(0), data.stride(0));
+
+  auto dataRangeStepInner = dataWrapper[2][brak::range(0, 8, 0)];
+
+  ASSERT_EQ(dataRangeStepInner.size(), 0);
+  ASSERT_EQ(std::distance(dataRangeStepInner.begin(),
+                          dataRangeStepInner.end()),
+            0);
+}
+
+TEST(test_wrapper_range, test_range_expression) {
+  View data{"data", 6, 4};
+  View dataOther{"dataOther", 3, 4};
+  brak::WrapperArray dataWrapper{data};
+  brak::WrapperArray dataOtherWrapper{dataOther};
+
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 4; j++) {
+      dataOther(i, j) = i + j;
+    }
+  }
+
+  // only the interior rows are assigned
+  brak::expr(dataWrapper[brak::range(2, 5)]) = 2 * dataOtherWrapper;
+  Kokkos::fence();
+
+  ASSERT_EQ(data(1, 3), 0);
+  ASSERT_EQ(data(2, 0), 0);
+  ASSERT_EQ(data(4, 3), 10);
+  ASSERT_EQ(data(5, 3), 0);
+}
@@ -4,3 +4,29 @@
 #define WRAPPER_NAME wrapper_subview
 
 #include "test_base.hpp"
+
+TEST(test_wrapper_subview, test_lazy_subview) {
+  using View = Kokkos::View<int ***, Kokkos::HostSpace>;
+  View data{"data", 4, 5, 6};
+  brak::WrapperSubview dataWrapper{data};
+
+  // the sub-wrappers keep the wrapped view and the pending indices
+  using ViewUnmanaged = kokkos_addendum::make_unmanaged<View>;
+  static_assert(std::is_same_v<decltype(dataWrapper[1][2]),
+                               brak::WrapperSubview<ViewUnmanaged, 2>>);
+
+  // the subview is materialized when retrieved
+  auto subview = dataWrapper[1][2].getView();
+  auto subviewExpected = Kokkos::subview(data, 1, 2, Kokkos::ALL);
+
+  static_assert(decltype(subview)::rank() == 1);
+  ASSERT_EQ(subview.data(), subviewExpected.data());
+  ASSERT_EQ(subview.extent(0), 6);
+  ASSERT_EQ(*(dataWrapper[1][2]), subviewExpected.data());
+
+  // or when converted to a view
+  decltype(subview) const subviewConverted = dataWrapper[1][2];
+  subviewConverted(3) = 10;
+
+  ASSERT_EQ(data(1, 2, 3), 10);
+}